@@ -105,6 +105,7 @@ option(WITH_DYNAMIC_LINKING "Enable dynamic library linking."
 option(WITH_STRICT_DATABASE_TYPE_CHECKS "Enable strict checking of database field value accessors" 0)
 option(WITHOUT_METRICS     "Disable metrics reporting (i.e. InfluxDB and Grafana)"       0)
 option(WITH_DETAILED_METRICS  "Enable detailed metrics reporting (i.e. time each session takes to update)" 0)
+option(WITH_IO_URING       "Use io_uring instead of epoll for network I/O, Network.WriteMode picks the write path at runtime (Linux only, needs Boost 1.78+ and liburing)" 0)
 
 CheckApplicationsBuildList()
 CheckToolsBuildList()
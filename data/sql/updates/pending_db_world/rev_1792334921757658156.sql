@@ -0,0 +1,6 @@
+--
+DELETE FROM `command` WHERE `name` IN ('server profile', 'server profile opcodes', 'server profile reset');
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('server profile', 3, 'Syntax: .server profile $subcommand\r\nType .server profile to see the list of possible subcommands or .help server profile $subcommand to see info on subcommands'),
+('server profile opcodes', 3, 'Syntax: .server profile opcodes [#count]\r\n\r\nShow the #count (default 10) client opcode handlers with the highest total time. Requires OpcodeProfiler.Enable.'),
+('server profile reset', 3, 'Syntax: .server profile reset\r\n\r\nReset all recorded opcode handler timings.');
@@ -101,6 +101,12 @@ if ( UNIX )
   else()
     message("* Use unix gperftools             : No  (default)")
   endif()
+
+  if( WITH_IO_URING )
+    message("* Use io_uring for network I/O    : Yes")
+  else()
+    message("* Use io_uring for network I/O    : No  (default)")
+  endif()
 endif( UNIX )
 
 if( WIN32 )
@@ -22,13 +22,27 @@
 #include "Errors.h"
 #include "HMAC.h"
 
+namespace
+{
+    constexpr std::array<uint8, 16> ServerEncryptionKey = { 0xCC, 0x98, 0xAE, 0x04, 0xE8, 0x97, 0xEA, 0xCA, 0x12, 0xDD, 0xC0, 0x93, 0x42, 0x91, 0x53, 0x57 };
+    constexpr std::array<uint8, 16> ServerDecryptionKey = { 0xC2, 0xB3, 0x72, 0x3C, 0xC6, 0xAE, 0xD9, 0xB5, 0x34, 0x3C, 0x53, 0xEE, 0x2F, 0x43, 0x67, 0xCE };
+}
+
 void AuthCrypt::Init(SessionKey const& K)
 {
-    uint8 ServerEncryptionKey[] = { 0xCC, 0x98, 0xAE, 0x04, 0xE8, 0x97, 0xEA, 0xCA, 0x12, 0xDD, 0xC0, 0x93, 0x42, 0x91, 0x53, 0x57 };
-    _serverEncrypt.Init(Warhead::Crypto::HMAC_SHA1::GetDigestOf(ServerEncryptionKey, K));
+    Init(K, ServerEncryptionKey, ServerDecryptionKey);
+}
+
+void AuthCrypt::InitClient(SessionKey const& K)
+{
+    // the client encrypts with the key the server decrypts with and vice versa
+    Init(K, ServerDecryptionKey, ServerEncryptionKey);
+}
 
-    uint8 ServerDecryptionKey[] = { 0xC2, 0xB3, 0x72, 0x3C, 0xC6, 0xAE, 0xD9, 0xB5, 0x34, 0x3C, 0x53, 0xEE, 0x2F, 0x43, 0x67, 0xCE };
-    _clientDecrypt.Init(Warhead::Crypto::HMAC_SHA1::GetDigestOf(ServerDecryptionKey, K));
+void AuthCrypt::Init(SessionKey const& K, std::array<uint8, 16> const& encryptKey, std::array<uint8, 16> const& decryptKey)
+{
+    _serverEncrypt.Init(Warhead::Crypto::HMAC_SHA1::GetDigestOf(encryptKey, K));
+    _clientDecrypt.Init(Warhead::Crypto::HMAC_SHA1::GetDigestOf(decryptKey, K));
 
     // Drop first 1024 bytes, as WoW uses ARC4-drop1024.
     std::array<uint8, 1024> syncBuf{};
@@ -27,12 +27,18 @@ public:
     AuthCrypt() = default;
 
     void Init(SessionKey const& K);
+
+    /// Initializes the ciphers for the client end of the connection, used by tools that connect to the worldserver
+    void InitClient(SessionKey const& K);
+
     void DecryptRecv(uint8* data, size_t len);
     void EncryptSend(uint8* data, size_t len);
 
     bool IsInitialized() const { return _initialized; }
 
 private:
+    void Init(SessionKey const& K, std::array<uint8, 16> const& encryptKey, std::array<uint8, 16> const& decryptKey);
+
     Warhead::Crypto::ARC4 _clientDecrypt;
     Warhead::Crypto::ARC4 _serverEncrypt;
     bool _initialized{ false };
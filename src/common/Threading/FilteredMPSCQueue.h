@@ -0,0 +1,113 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef FilteredMPSCQueue_h__
+#define FilteredMPSCQueue_h__
+
+#include "MPSCQueue.h"
+#include <deque>
+#include <iterator>
+
+// Intrusive MPSC queue whose single consumer can look at the front element before taking it.
+// Producers never take a lock; the element the consumer has already pulled out of the
+// lock free part (and any element it puts back) is kept in a consumer owned deque.
+// The consumer may change threads, as long as two consumers never run at the same time.
+template<typename T, std::atomic<T*> T::* IntrusiveLink>
+class FilteredMPSCQueue
+{
+public:
+    FilteredMPSCQueue() = default;
+
+    ~FilteredMPSCQueue()
+    {
+        for (T* item : _front)
+            delete item;
+    }
+
+    //! Producer side, any thread
+    void Enqueue(T* input)
+    {
+        _size.fetch_add(1, std::memory_order_relaxed);
+        _queue.Enqueue(input);
+    }
+
+    //! Takes the next element, if any
+    bool Dequeue(T*& result)
+    {
+        if (!Peek())
+            return false;
+
+        result = Pop();
+        return true;
+    }
+
+    //! Takes the next element only if the checker accepts it, otherwise it stays at the front
+    template<class Checker>
+    bool Dequeue(T*& result, Checker& check)
+    {
+        T* front = Peek();
+        if (!front || !check.Process(front))
+            return false;
+
+        result = Pop();
+        return true;
+    }
+
+    //! Puts elements taken by the consumer back at the front, in the given order
+    template<class Iterator>
+    void Requeue(Iterator begin, Iterator end)
+    {
+        _size.fetch_add(std::distance(begin, end), std::memory_order_relaxed);
+        _front.insert(_front.begin(), begin, end);
+    }
+
+    //! Approximate number of queued elements, may be read from any thread
+    [[nodiscard]] std::size_t Size() const { return _size.load(std::memory_order_relaxed); }
+
+private:
+    T* Peek()
+    {
+        if (_front.empty())
+        {
+            T* next = nullptr;
+            if (!_queue.Dequeue(next))
+                return nullptr;
+
+            _front.push_back(next);
+        }
+
+        return _front.front();
+    }
+
+    T* Pop()
+    {
+        T* result = _front.front();
+        _front.pop_front();
+        _size.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    MPSCQueue<T, IntrusiveLink> _queue;
+    std::deque<T*> _front;
+    std::atomic<std::size_t> _size{ 0 };
+
+    FilteredMPSCQueue(FilteredMPSCQueue const&) = delete;
+    FilteredMPSCQueue& operator=(FilteredMPSCQueue const&) = delete;
+};
+
+#endif // FilteredMPSCQueue_h__
@@ -20,6 +20,7 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
 
 void EventMap::Reset()
 {
@@ -68,7 +69,7 @@ void EventMap::ScheduleEvent(uint32 eventId, uint32 time, uint32 group /*= 0*/,
         eventId |= (1 << (phase + 23));
     }
 
-    _eventMap.emplace(_time + time, eventId);
+    Insert(_time + time, eventId);
 }
 
 void EventMap::ScheduleEvent(uint32 eventId, Milliseconds time, uint32 group /*= 0*/, uint8 phase /* = 0*/)
@@ -101,7 +102,7 @@ void EventMap::RescheduleEvent(uint32 eventId, Milliseconds minTime, Millisecond
 
 void EventMap::RepeatEvent(uint32 time)
 {
-    _eventMap.emplace(_time + time, _lastEvent);
+    Insert(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds time)
@@ -152,18 +153,22 @@ void EventMap::DelayEvents(Milliseconds delay)
 
 void EventMap::DelayEventsToMax(uint32 delay, uint32 group)
 {
+    EventStore delayed;
+
     for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
     {
         if (itr->first < _time + delay && (group == 0 || ((1 << (group + 15)) & itr->second)))
         {
-            ScheduleEvent(itr->second, delay);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
+            delayed.emplace_back(_time + delay, itr->second);
+            itr = _eventMap.erase(itr);
             continue;
         }
 
         ++itr;
     }
+
+    for (auto const& [time, eventData] : delayed)
+        Insert(time, eventData);
 }
 
 void EventMap::CancelEvent(uint32 eventId)
@@ -173,16 +178,7 @@ void EventMap::CancelEvent(uint32 eventId)
         return;
     }
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (eventId == (itr->second & 0x0000FFFF))
-        {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
+    std::erase_if(_eventMap, [eventId](EventStore::value_type const& itr) { return eventId == (itr.second & 0x0000FFFF); });
 }
 
 void EventMap::CancelEventGroup(uint32 group)
@@ -193,17 +189,7 @@ void EventMap::CancelEventGroup(uint32 group)
     }
 
     uint32 groupMask = (1 << (group + 15));
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (itr->second & groupMask)
-        {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+    std::erase_if(_eventMap, [groupMask](EventStore::value_type const& itr) { return (itr.second & groupMask) != 0; });
 }
 
 uint32 EventMap::GetNextEventTime(uint32 eventId) const
@@ -236,9 +222,15 @@ bool EventMap::IsInPhase(uint8 phase)
 
 Milliseconds EventMap::GetTimeUntilEvent(uint32 eventId) const
 {
-    for (std::pair<uint32 const, uint32> const& itr : _eventMap)
+    for (std::pair<uint32, uint32> const& itr : _eventMap)
         if (eventId == (itr.second & 0x0000FFFF))
             return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr.first) - Milliseconds(_time));
 
     return Milliseconds::max();
 }
+
+void EventMap::Insert(uint32 time, uint32 eventData)
+{
+    auto itr = std::upper_bound(_eventMap.begin(), _eventMap.end(), time, [](uint32 value, EventStore::value_type const& event) { return value < event.first; });
+    _eventMap.emplace(itr, time, eventData);
+}
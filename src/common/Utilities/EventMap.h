@@ -20,14 +20,17 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <utility>
+#include <vector>
 
 class WH_COMMON_API EventMap
 {
     /**
-    * Internal storage type.
-    * Key: Time as TimePoint when the event should occur.
-    * Value: The event data as uint32.
+    * Internal storage type, kept sorted by time. Boss scripts only hold a
+    * handful of events, a contiguous vector avoids a node allocation per
+    * scheduled event. Events with the same time keep their insertion order.
+    * First: Time as TimePoint when the event should occur.
+    * Second: The event data as uint32.
     *
     * Structure of event data:
     * - Bit  0 - 15: Event Id.
@@ -35,7 +38,7 @@ class WH_COMMON_API EventMap
     * - Bit 24 - 31: Phase
     * - Pattern: 0xPPGGEEEE
     */
-    typedef std::multimap<uint32, uint32> EventStore;
+    typedef std::vector<std::pair<uint32, uint32>> EventStore;
 
 public:
     EventMap() { }
@@ -244,7 +247,7 @@ public:
         {
             if (!group || (itr->second & (1 << (group + 15))))
             {
-                delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
+                delayed.emplace_back(itr->first + delay, itr->second);
                 itr = _eventMap.erase(itr);
                 continue;
             }
@@ -252,7 +255,8 @@ public:
             ++itr;
         }
 
-        _eventMap.insert(delayed.begin(), delayed.end());
+        for (auto const& [time, eventData] : delayed)
+            Insert(time, eventData);
     }
 
     // DelayEventsToMax
@@ -331,6 +335,12 @@ private:
     */
     uint32 _lastEvent{0};
 
+    /**
+    * @name Insert
+    * @brief Stores an event after all events scheduled at the same time.
+    */
+    void Insert(uint32 time, uint32 eventData);
+
     /**
     * @name _eventMap
     * @brief Internal event storage map. Contains the scheduled events.
@@ -20,6 +20,7 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <vector>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -45,13 +46,12 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
-    // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    // main event loop, the wheel hands out events in execution time order
+    m_events.Advance(m_time, [this, p_time](BasicEvent* event, uint64 /*execTime*/)
     {
-        // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        // event is already removed from queue
+        event->m_timerNode = nullptr;
+        event->m_owner = nullptr;
 
         if (event->IsRunning())
         {
@@ -60,7 +60,7 @@ void EventProcessor::Update(uint32 p_time)
                 // completely destroy event if it is not re-added
                 delete event;
             }
-            continue;
+            return;
         }
 
         if (event->IsAbortScheduled())
@@ -73,66 +73,61 @@ void EventProcessor::Update(uint32 p_time)
         if (event->IsDeletable())
         {
             delete event;
-            continue;
+            return;
         }
 
         // Reschedule non deletable events to be checked at
         // the next update tick
         AddEvent(event, CalculateTime(1), false, 0);
-    }
+    });
 }
 
 void EventProcessor::KillAllEvents(bool force)
 {
+    std::vector<BasicEvent*> events;
+    events.reserve(m_events.Size());
+    m_events.Visit([&events](EventList::Node const& node) { events.push_back(node.GetValue()); });
+
     // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    for (BasicEvent* event : events)
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
-        {
-            ++itr;
+        if (!force && !event->IsDeletable())
             continue;
-        }
-
-        delete itr->second;
 
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        DequeueEvent(event);
+        delete event;
     }
-
-    if (force)
-        m_events.clear();
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    std::vector<BasicEvent*> events;
+    m_events.Visit([&events, group](EventList::Node const& node)
     {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
-            continue;
-        }
+        if (node.GetValue()->m_eventGroup == group)
+            events.push_back(node.GetValue());
+    });
 
+    for (BasicEvent* event : events)
+    {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
+        DequeueEvent(event);
+        delete event;
     }
 }
 
@@ -142,21 +137,27 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    Event->m_owner = this;
+    Event->m_timerNode = m_events.Schedule(Event, e_time);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    if (event->m_owner != this || !event->m_timerNode)
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    event->m_execTime = newTime.count();
+    m_events.Reschedule(event->m_timerNode, newTime.count());
+}
+
+void EventProcessor::DequeueEvent(BasicEvent* event)
+{
+    if (event->m_owner != this || !event->m_timerNode)
+        return;
+
+    m_events.Cancel(event->m_timerNode);
+    event->m_timerNode = nullptr;
+    event->m_owner = nullptr;
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
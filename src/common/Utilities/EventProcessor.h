@@ -19,11 +19,14 @@
 #define __EVENTPROCESSOR_H
 
 #include "Random.h"
-#include <map>
+#include "TimerWheel.h"
 #include <type_traits>
 
+class BasicEvent;
 class EventProcessor;
 
+typedef TimerWheel<BasicEvent*> EventList;
+
 // Note. All times are in milliseconds here.
 class WH_COMMON_API BasicEvent
 {
@@ -64,6 +67,9 @@ private:
     uint64 m_addTime{0};                                   // time when the event was added to queue, filled by event handler
     uint64 m_execTime{0};                                  // planned time of next execution, filled by event handler
     uint8 m_eventGroup{0};
+
+    EventProcessor* m_owner{nullptr};                      // processor the event is currently queued in
+    EventList::Node* m_timerNode{nullptr};                 // position in the owner queue, null while not queued
 };
 
 template<typename T>
@@ -86,8 +92,6 @@ private:
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<std::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
-
 class WH_COMMON_API EventProcessor
 {
 public:
@@ -122,6 +126,9 @@ public:
         uint64 m_time{0};
         EventList m_events;
         bool m_aborting;
+
+    private:
+        void DequeueEvent(BasicEvent* event);
 };
 
 #endif
\ No newline at end of file
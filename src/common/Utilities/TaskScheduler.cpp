@@ -20,6 +20,7 @@
 
 #include "TaskScheduler.h"
 #include "Errors.h"
+#include <algorithm>
 
 TaskScheduler& TaskScheduler::ClearValidator()
 {
@@ -97,16 +98,12 @@ void TaskScheduler::Dispatch(success_t const& callback)
         }
     }
 
-    while (!_task_holder.IsEmpty())
+    TaskContainer task;
+    while (_task_holder.Pop(_now, task))
     {
-        if (_task_holder.First()->_end > _now)
-        {
-            break;
-        }
-
         // Perfect forward the context to the handler
         // Use weak references to catch destruction before callbacks.
-        TaskContext context(_task_holder.Pop(), std::weak_ptr<TaskScheduler>(self_reference));
+        TaskContext context(std::move(task), std::weak_ptr<TaskScheduler>(self_reference));
 
         // Invoke the context
         context.Invoke();
@@ -127,74 +124,75 @@ bool TaskScheduler::IsGroupScheduled(group_t const group)
     return _task_holder.IsGroupQueued(group);
 }
 
-void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
+uint64 TaskScheduler::TaskQueue::GetExpiry(timepoint_t const& end) const
 {
-    container.insert(task);
+    if (end <= _epoch)
+        return 0;
+
+    return uint64(std::chrono::ceil<std::chrono::milliseconds>(end - _epoch).count());
 }
 
-auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
+void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
-    return result;
+    uint64 const expiry = GetExpiry(task->_end);
+    container.Schedule(std::move(task), expiry);
 }
 
-auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
+bool TaskScheduler::TaskQueue::Pop(timepoint_t const& now, TaskContainer& task)
 {
-    return *container.begin();
+    uint64 const time = now > _epoch ? uint64(std::chrono::floor<std::chrono::milliseconds>(now - _epoch).count()) : 0;
+    uint64 expiry;
+    return container.Pop(time, task, expiry);
 }
 
 void TaskScheduler::TaskQueue::Clear()
 {
-    container.clear();
+    container.Clear();
 }
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    std::vector<TimerWheel<TaskContainer>::Node*> removed;
+    container.VisitNodes([&](TimerWheel<TaskContainer>::Node* node)
+    {
+        if (filter(node->GetValue()))
+            removed.push_back(node);
+    });
+
+    for (auto node : removed)
+        container.Cancel(node);
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    std::vector<TimerWheel<TaskContainer>::Node*> modified;
+    container.VisitNodes([&](TimerWheel<TaskContainer>::Node* node)
+    {
+        if (filter(node->GetValue()))
+            modified.push_back(node);
+    });
+
+    // keep the previous order between tasks which end at the same time afterwards
+    std::sort(modified.begin(), modified.end(), [](auto left, auto right) { return left->FiresBefore(*right); });
 
-    container.insert(cache.begin(), cache.end());
+    for (auto node : modified)
+        container.Reschedule(node, GetExpiry(node->GetValue()->_end));
 }
 
 bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
 {
-    for (auto const& task : container)
+    bool queued = false;
+    container.Visit([&queued, group](TimerWheel<TaskContainer>::Node const& node)
     {
-        if (task->IsInGroup(group))
-        {
-            return true;
-        }
-    }
+        queued = queued || node.GetValue()->IsInGroup(group);
+    });
 
-    return false;
+    return queued;
 }
 
 bool TaskScheduler::TaskQueue::IsEmpty() const
 {
-    return container.empty();
+    return container.Empty();
 }
 
 TaskContext& TaskContext::Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply)
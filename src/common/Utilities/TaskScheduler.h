@@ -18,13 +18,13 @@
 #ifndef _TASK_SCHEDULER_H_
 #define _TASK_SCHEDULER_H_
 
+#include "TimerWheel.h"
 #include "Util.h"
 #include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <queue>
-#include <set>
 #include <utility>
 #include <vector>
 
@@ -120,26 +120,24 @@ class WH_COMMON_API TaskScheduler
     typedef std::shared_ptr<Task> TaskContainer;
 
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
-    {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
-        {
-            return (*left.get()) < (*right.get());
-        };
-    };
-
+    /// Tasks are kept in a timing wheel with millisecond resolution, counted from the
+    /// creation of the scheduler. Tasks with the same end run in scheduling order.
     class WH_COMMON_API TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        TimerWheel<TaskContainer> container;
+        timepoint_t const _epoch;
+
+        // Wheel time of a task end, rounded up so a task never runs before its end
+        uint64 GetExpiry(timepoint_t const& end) const;
 
     public:
+        explicit TaskQueue(timepoint_t const& epoch) : _epoch(epoch) { }
+
         // Pushes the task in the container
         void Push(TaskContainer&& task);
 
-        /// Pops the task out of the container
-        TaskContainer Pop();
-
-        TaskContainer const& First() const;
+        /// Pops the next task which ended at the given time point, returns false if there is none
+        bool Pop(timepoint_t const& now, TaskContainer& task);
 
         void Clear();
 
@@ -181,10 +179,10 @@ class WH_COMMON_API TaskScheduler
 
 public:
     TaskScheduler()
-        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _predicate(EmptyValidator) { }
+        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _task_holder(_now), _predicate(EmptyValidator) { }
 
     template<typename P> TaskScheduler(P&& predicate)
-        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _predicate(std::forward<P>(predicate)) { }
+        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _task_holder(_now), _predicate(std::forward<P>(predicate)) { }
 
     TaskScheduler(TaskScheduler const&) = delete;
     TaskScheduler(TaskScheduler&&) = delete;
@@ -0,0 +1,534 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+
+#include "Define.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <vector>
+
+/// Hierarchical timing wheel with millisecond resolution.
+/// Schedule, Cancel and Reschedule are O(1), Advance only stops at occupied slots
+/// and at the slot boundaries which need a cascade. Nodes are intrusive and recycled
+/// through a per wheel pool, so a warmed up wheel does not allocate. The pool starts with
+/// a small chunk on the first Schedule, a wheel that is never used allocates nothing.
+/// Small populations (most units and scripts) are kept in a plain sorted list instead,
+/// which is cheaper than walking the wheel; the wheel is only built past SORTED_LIMIT entries
+/// and its slots are freed again once the population merges back into the list.
+/// Entries with the same expiry time are returned in scheduling order.
+template<typename T>
+class TimerWheel
+{
+    static constexpr uint32 SLOT_BITS = 6;
+    static constexpr uint32 SLOT_COUNT = 1 << SLOT_BITS;
+    static constexpr uint64 SLOT_MASK = SLOT_COUNT - 1;
+    static constexpr uint32 LEVEL_COUNT = 3;
+    static constexpr uint64 WHEEL_RANGE = uint64(1) << (SLOT_BITS * LEVEL_COUNT);
+    static constexpr std::size_t POOL_FIRST_CHUNK_SIZE = 4;
+    static constexpr std::size_t POOL_CHUNK_SIZE = 32;
+    static constexpr std::size_t SORTED_LIMIT = 32;
+    static constexpr std::size_t MERGE_LIMIT = 8;
+
+public:
+    class Node
+    {
+        friend class TimerWheel;
+
+    public:
+        [[nodiscard]] T const& GetValue() const { return _value; }
+        [[nodiscard]] uint64 GetExpiry() const { return _expiry; }
+
+        /// True if this node is returned before the other one, when both are due
+        [[nodiscard]] bool FiresBefore(Node const& other) const
+        {
+            return _expiry != other._expiry ? _expiry < other._expiry : _sequence < other._sequence;
+        }
+
+    private:
+        Node* _next{ nullptr };
+        Node** _prev{ nullptr };
+        uint64 _expiry{ 0 };
+        uint64 _sequence{ 0 };
+        T _value{};
+    };
+
+    TimerWheel() = default;
+
+    TimerWheel(TimerWheel const&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /// Schedules value to be returned by Advance once the wheel time reaches expiry.
+    /// Expiry times which are already reached are returned by the next Advance call.
+    Node* Schedule(T value, uint64 expiry)
+    {
+        Node* node = Acquire();
+        node->_value = std::move(value);
+        node->_expiry = expiry;
+        node->_sequence = _sequence++;
+
+        if (!_spilled && _size >= SORTED_LIMIT)
+            Spill();
+
+        if (_spilled)
+            Link(node);
+        else
+            InsertSorted(node);
+
+        ++_size;
+        return node;
+    }
+
+    /// Removes a scheduled node, the node must not be used afterwards.
+    void Cancel(Node* node)
+    {
+        Unlink(node);
+        Release(node);
+        --_size;
+    }
+
+    /// Moves a scheduled node to a new expiry time, keeping the node valid.
+    void Reschedule(Node* node, uint64 expiry)
+    {
+        Unlink(node);
+        node->_expiry = expiry;
+        node->_sequence = _sequence++;
+
+        if (_spilled)
+            Link(node);
+        else
+            InsertSorted(node);
+    }
+
+    /// Moves the wheel time forward and calls callback(T value, uint64 expiry) for every
+    /// entry with expiry <= time, in expiry order. The node is released before the callback
+    /// runs, so the callback may schedule new entries (including already expired ones).
+    template<typename Callback>
+    void Advance(uint64 time, Callback&& callback)
+    {
+        // nothing due, the common case of a small queue
+        if (!_spilled && (!_sorted || _sorted->_expiry > time))
+        {
+            _time = std::max(_time, time);
+            return;
+        }
+
+        T value;
+        uint64 expiry;
+
+        while (Pop(time, value, expiry))
+            callback(std::move(value), expiry);
+    }
+
+    /// Removes the earliest entry with expiry <= time and returns true, or moves the wheel
+    /// time to 'time' and returns false when there is none left. Unlike Advance it lets
+    /// the caller stop in the middle of the due entries.
+    bool Pop(uint64 time, T& value, uint64& expiry)
+    {
+        if (!_spilled)
+        {
+            if (_sorted && _sorted->_expiry <= time)
+            {
+                Take(_sorted, value, expiry);
+                return true;
+            }
+
+            _time = std::max(_time, time);
+            return false;
+        }
+
+        while (!_due && _time < time)
+        {
+            uint64 const next = _size ? NextStop() : time + 1;
+            if (next > time)
+            {
+                _time = time;
+                break;
+            }
+
+            // every slot before 'next' is empty and every boundary before it needs no cascade
+            uint32 const index = uint32(next & SLOT_MASK);
+            if (!index)
+                Cascade(next);
+
+            _time = next;
+
+            if (Node* list = DetachSlot(0, index))
+                Collect(list);
+        }
+
+        if (_due)
+        {
+            // entries which became due while firing are ordered by expiry first
+            Node* node = _due;
+            for (Node* itr = node->_next; itr; itr = itr->_next)
+                if (itr->_expiry < node->_expiry || (itr->_expiry == node->_expiry && itr->_sequence < node->_sequence))
+                    node = itr;
+
+            Take(node, value, expiry);
+            return true;
+        }
+
+        if (_size <= MERGE_LIMIT)
+            Merge();
+
+        return false;
+    }
+
+    /// Calls visitor(Node const&) for every scheduled entry, in no particular order.
+    /// The visitor must not modify the wheel.
+    template<typename Visitor>
+    void Visit(Visitor&& visitor) const
+    {
+        for (Node const* node = _sorted; node; node = node->_next)
+            visitor(*node);
+
+        for (Node const* node = _due; node; node = node->_next)
+            visitor(*node);
+
+        for (Node const* node = _overflow; node; node = node->_next)
+            visitor(*node);
+
+        if (!_slots)
+            return;
+
+        for (Node* const& head : *_slots)
+            for (Node const* node = head; node; node = node->_next)
+                visitor(*node);
+    }
+
+    /// Calls visitor(Node*) for every scheduled entry, in no particular order.
+    /// The visitor must not modify the wheel, collect the nodes to Cancel or Reschedule them afterwards.
+    template<typename Visitor>
+    void VisitNodes(Visitor&& visitor)
+    {
+        for (Node* node = _sorted; node; node = node->_next)
+            visitor(node);
+
+        for (Node* node = _due; node; node = node->_next)
+            visitor(node);
+
+        for (Node* node = _overflow; node; node = node->_next)
+            visitor(node);
+
+        if (!_slots)
+            return;
+
+        for (Node* head : *_slots)
+            for (Node* node = head; node; node = node->_next)
+                visitor(node);
+    }
+
+    /// Removes every entry without calling anything.
+    void Clear()
+    {
+        ReleaseList(_sorted);
+        ReleaseList(_due);
+        ReleaseList(_overflow);
+
+        if (_slots)
+            for (Node*& head : *_slots)
+                ReleaseList(head);
+
+        _slots.reset();
+        _occupied.fill(0);
+        _size = 0;
+        _spilled = false;
+    }
+
+    [[nodiscard]] uint64 GetTime() const { return _time; }
+    [[nodiscard]] std::size_t Size() const { return _size; }
+    [[nodiscard]] bool Empty() const { return !_size; }
+
+private:
+    typedef std::array<Node*, SLOT_COUNT * LEVEL_COUNT> SlotStore;
+
+    void Link(Node* node)
+    {
+        if (node->_expiry <= _time)
+        {
+            PushFront(&_due, node);
+            return;
+        }
+
+        // distance from the next slot to process, which is _time + 1
+        uint64 const delta = node->_expiry - _time - 1;
+        if (delta >= WHEEL_RANGE)
+        {
+            PushFront(&_overflow, node);
+            return;
+        }
+
+        uint32 level = 0;
+        while (delta >= (uint64(1) << (SLOT_BITS * (level + 1))))
+            ++level;
+
+        uint32 const index = uint32((node->_expiry >> (SLOT_BITS * level)) & SLOT_MASK);
+
+        if (!_slots)
+        {
+            _slots = std::make_unique<SlotStore>();
+            _slots->fill(nullptr);
+        }
+
+        PushFront(&(*_slots)[level * SLOT_COUNT + index], node);
+        _occupied[level] |= uint64(1) << index;
+    }
+
+    void InsertSorted(Node* node)
+    {
+        Node** link = &_sorted;
+        while (*link && (*link)->_expiry <= node->_expiry)
+            link = &(*link)->_next;
+
+        node->_next = *link;
+        node->_prev = link;
+        if (*link)
+            (*link)->_prev = &node->_next;
+        *link = node;
+    }
+
+    // Moves the sorted list into the wheel
+    void Spill()
+    {
+        Node* list = _sorted;
+        _sorted = nullptr;
+        _spilled = true;
+
+        while (list)
+        {
+            Node* node = list;
+            list = list->_next;
+            Link(node);
+        }
+    }
+
+    // Moves a small wheel population back into the sorted list
+    void Merge()
+    {
+        _collected.clear();
+
+        auto collect = [this](Node*& head)
+        {
+            for (Node* node = head; node; node = node->_next)
+                _collected.push_back(node);
+            head = nullptr;
+        };
+
+        collect(_due);
+        collect(_overflow);
+        if (_slots)
+            for (Node*& head : *_slots)
+                if (head)
+                    collect(head);
+
+        std::sort(_collected.begin(), _collected.end(), [](Node const* left, Node const* right)
+        {
+            return left->_expiry != right->_expiry ? left->_expiry > right->_expiry : left->_sequence > right->_sequence;
+        });
+
+        for (Node* node : _collected)
+            PushFront(&_sorted, node);
+
+        // a large population is gone, don't keep its buffers for the rest of the owner's lifetime
+        _slots.reset();
+        _collected = {};
+        _occupied.fill(0);
+        _spilled = false;
+    }
+
+    void Unlink(Node* node)
+    {
+        *node->_prev = node->_next;
+        if (node->_next)
+            node->_next->_prev = node->_prev;
+
+        node->_next = nullptr;
+        node->_prev = nullptr;
+    }
+
+    static void PushFront(Node** head, Node* node)
+    {
+        node->_next = *head;
+        node->_prev = head;
+        if (*head)
+            (*head)->_prev = &node->_next;
+        *head = node;
+    }
+
+    Node* DetachSlot(uint32 level, uint32 index)
+    {
+        _occupied[level] &= ~(uint64(1) << index);
+
+        if (!_slots)
+            return nullptr;
+
+        Node*& head = (*_slots)[level * SLOT_COUNT + index];
+        Node* list = head;
+        head = nullptr;
+        return list;
+    }
+
+    // Earliest time after _time at which a level 0 slot may hold entries or a cascade is due.
+    // Top level cascades are not tracked, the wheel simply stops at every level 1 wrap.
+    [[nodiscard]] uint64 NextStop() const
+    {
+        uint64 const next = _time + 1;
+        uint32 const index = uint32(next & SLOT_MASK);
+        uint64 const rotation = next - index;
+
+        uint64 stop = std::numeric_limits<uint64>::max();
+        if (uint64 const current = _occupied[0] >> index)
+            stop = next + std::countr_zero(current);
+        else if (_occupied[0])
+            stop = rotation + SLOT_COUNT + std::countr_zero(_occupied[0]);
+
+        uint64 const boundary = index ? rotation + SLOT_COUNT : next;
+        uint32 const upperIndex = uint32((boundary >> SLOT_BITS) & SLOT_MASK);
+        if (!upperIndex)
+            return std::min(stop, boundary);
+
+        if (uint64 const upper = _occupied[1] >> upperIndex)
+            return std::min(stop, boundary + (uint64(std::countr_zero(upper)) << SLOT_BITS));
+
+        return std::min(stop, boundary + (uint64(SLOT_COUNT - upperIndex) << SLOT_BITS));
+    }
+
+    // Redistributes the higher level slots reached by the wheel time 'next'
+    void Cascade(uint64 next)
+    {
+        for (uint32 level = 1; level < LEVEL_COUNT; ++level)
+        {
+            uint32 const index = uint32((next >> (SLOT_BITS * level)) & SLOT_MASK);
+            if (_occupied[level] & (uint64(1) << index))
+                Relink(DetachSlot(level, index), next);
+
+            if (index)
+                return;
+        }
+
+        // the top level wrapped, pull in everything that is close enough now
+        Node* list = _overflow;
+        _overflow = nullptr;
+        Relink(list, next);
+    }
+
+    void Relink(Node* list, uint64 next)
+    {
+        // link relative to the slot about to be processed
+        uint64 const time = _time;
+        _time = next - 1;
+
+        while (list)
+        {
+            Node* node = list;
+            list = list->_next;
+            Link(node);
+        }
+
+        _time = time;
+    }
+
+    // Moves a level 0 slot (all entries share the same expiry) to the due list in scheduling order
+    void Collect(Node* list)
+    {
+        _collected.clear();
+        for (Node* node = list; node; node = node->_next)
+            _collected.push_back(node);
+
+        std::sort(_collected.begin(), _collected.end(), [](Node const* left, Node const* right) { return left->_sequence > right->_sequence; });
+
+        for (Node* node : _collected)
+            PushFront(&_due, node);
+    }
+
+    void Take(Node* node, T& value, uint64& expiry)
+    {
+        Unlink(node);
+        value = std::move(node->_value);
+        expiry = node->_expiry;
+        Release(node);
+        --_size;
+    }
+
+    Node* Acquire()
+    {
+        if (!_free)
+        {
+            // chunks double up to POOL_CHUNK_SIZE, most owners only ever hold a few entries
+            std::size_t const chunkSize = _pool.empty() ? POOL_FIRST_CHUNK_SIZE : std::min(POOL_CHUNK_SIZE, _lastChunkSize * 2);
+            _pool.push_back(std::make_unique<Node[]>(chunkSize));
+            _lastChunkSize = chunkSize;
+
+            Node* chunk = _pool.back().get();
+            for (std::size_t i = 0; i < chunkSize; ++i)
+            {
+                chunk[i]._next = _free;
+                _free = &chunk[i];
+            }
+        }
+
+        Node* node = _free;
+        _free = node->_next;
+        node->_next = nullptr;
+        return node;
+    }
+
+    void ReleaseList(Node*& head)
+    {
+        while (head)
+        {
+            Node* node = head;
+            head = head->_next;
+            Release(node);
+        }
+    }
+
+    void Release(Node* node)
+    {
+        node->_value = T{};
+        node->_next = _free;
+        node->_prev = nullptr;
+        _free = node;
+    }
+
+    // read by every Advance of a small queue, kept on the first cache line
+    Node* _sorted{ nullptr };
+    bool _spilled{ false };
+    uint64 _time{ 0 };
+    uint64 _sequence{ 0 };
+    std::size_t _size{ 0 };
+
+    // slots which may hold entries, bits are only cleared when a slot is processed
+    std::array<uint64, LEVEL_COUNT> _occupied{};
+    std::unique_ptr<SlotStore> _slots;
+    Node* _due{ nullptr };
+    Node* _overflow{ nullptr };
+
+    std::vector<Node*> _collected;
+    std::vector<std::unique_ptr<Node[]>> _pool;
+    std::size_t _lastChunkSize{ 0 };
+    Node* _free{ nullptr };
+};
+
+#endif
@@ -38,6 +38,7 @@
 #include "Metric.h"
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
+#include "OpcodeProfiler.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
 #include "ProcessPriority.h"
@@ -280,6 +281,15 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(AuthDatabase.GetQueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.GetQueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.GetQueueSize()));
+        METRIC_VALUE("broadcast_copy_bytes_saved", WorldSession::GetSharedPacketBytesSaved());
+        sOpcodeProfiler->LogMetrics();
+
+        auto sendLatency = WorldSocket::CollectSendLatency();
+        for (std::size_t i = 0; i < sendLatency.size(); ++i)
+        {
+            std::string bucket = i < WorldSocketSendLatencyBuckets.size() ? std::to_string(WorldSocketSendLatencyBuckets[i]) : "inf";
+            METRIC_VALUE("send_latency_us", sendLatency[i], METRIC_TAG("le", bucket));
+        }
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
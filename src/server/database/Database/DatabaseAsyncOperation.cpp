@@ -73,5 +73,5 @@ void PreparedStatementTask::ExecuteQuery()
 
 void CheckAsyncQueueTask::Execute()
 {
-    _dbPool->CheckAsyncQueue();
+    _dbPool->UpdateConnections();
 }
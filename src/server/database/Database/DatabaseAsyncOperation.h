@@ -19,6 +19,7 @@
 #define _DATABASE_ASYNC_OPERATION_H_
 
 #include "DatabaseEnvFwd.h"
+#include "Duration.h"
 
 class DatabaseWorkerPool;
 
@@ -33,9 +34,13 @@ public:
     virtual void ExecuteQuery() = 0;
     inline void SetConnection(MySQLConnection* connection) { _connection = connection; }
 
+    inline void SetEnqueueTime(TimePoint enqueueTime) { _enqueueTime = enqueueTime; }
+    [[nodiscard]] inline TimePoint GetEnqueueTime() const { return _enqueueTime; }
+
 protected:
     MySQLConnection* _connection{ nullptr };
     bool _hasResult{};
+    TimePoint _enqueueTime;
 
 private:
     AsyncOperation(AsyncOperation const& right) = delete;
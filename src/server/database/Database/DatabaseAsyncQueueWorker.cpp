@@ -17,6 +17,7 @@
 
 #include "DatabaseAsyncQueueWorker.h"
 #include "DatabaseAsyncOperation.h"
+#include "MySQLConnection.h"
 #include "PCQueue.h"
 
 AsyncDBQueueWorker::AsyncDBQueueWorker(ProducerConsumerQueue<AsyncOperation*>* dbQueue, MySQLConnection* connection)
@@ -46,14 +47,23 @@ void AsyncDBQueueWorker::ExecuteAsyncQueue()
 
         _queue->WaitAndPop(operation, _cancel);
 
-        if (_cancel)
-            break;
-
+        // An operation popped before the cancel still runs, the connection can be closed while the queue is in use
         if (!operation)
+        {
+            if (_cancel)
+                break;
+
             continue;
+        }
+
+        auto const startTime = std::chrono::steady_clock::now();
 
         operation->SetConnection(_connection);
         operation->ExecuteQuery();
+
+        _connection->AddAsyncOperation(std::chrono::duration_cast<Microseconds>(startTime - operation->GetEnqueueTime()),
+            std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - startTime));
+
         delete operation;
     }
 }
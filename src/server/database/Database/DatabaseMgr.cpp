@@ -25,6 +25,7 @@
 #include "Log.h"
 #include "Timer.h"
 #include <errmsg.h>
+#include <future>
 #include <mysql.h>
 #include <mysqld_error.h>
 
@@ -34,6 +35,7 @@ DatabaseMgr::DatabaseMgr()
 
     _autoSetup = sConfigMgr->GetOption<bool>("Updates.AutoSetup", true);
     _updateFlags = sConfigMgr->GetOption<uint32>("Updates.EnableDatabases", 0);
+    _parallelUpdates = sConfigMgr->GetOption<bool>("Updates.Parallel", false);
 }
 
 DatabaseMgr::~DatabaseMgr()
@@ -120,7 +122,7 @@ void DatabaseMgr::AddDatabase(DatabaseWorkerPool& pool, std::string_view name)
     {
         _populate.emplace([this, name, &pool]() -> bool
         {
-           if (!DBUpdater::Populate(pool))
+           if (!DBUpdater::Populate(pool, !_parallelUpdates, _importThreads))
            {
                LOG_ERROR("db", "Could not populate the {} database, see log for details.", name);
                return false;
@@ -131,7 +133,7 @@ void DatabaseMgr::AddDatabase(DatabaseWorkerPool& pool, std::string_view name)
 
         _update.emplace([this, name, &pool]() -> bool
         {
-             if (!DBUpdater::Update(pool, _modulesList))
+             if (!DBUpdater::Update(pool, _modulesList, !_parallelUpdates))
              {
                  LOG_ERROR("db", "Could not update the {} database, see log for details.", name);
                  return false;
@@ -181,12 +183,12 @@ bool DatabaseMgr::OpenDatabases()
 
 bool DatabaseMgr::PopulateDatabases()
 {
-    return Process(_populate);
+    return _parallelUpdates ? ProcessParallel(_populate) : Process(_populate);
 }
 
 bool DatabaseMgr::UpdateDatabases()
 {
-    return Process(_update);
+    return _parallelUpdates ? ProcessParallel(_update) : Process(_update);
 }
 
 bool DatabaseMgr::PrepareStatements()
@@ -216,6 +218,36 @@ bool DatabaseMgr::Process(std::queue<Predicate>& queue)
     return true;
 }
 
+bool DatabaseMgr::ProcessParallel(std::queue<Predicate>& queue)
+{
+    // The databases are independent, each one has its own connections
+    std::vector<std::future<bool>> results;
+
+    while (!queue.empty())
+    {
+        results.emplace_back(std::async(std::launch::async, std::move(queue.front())));
+        queue.pop();
+    }
+
+    bool success{ true };
+
+    for (auto& result : results)
+        if (!result.get())
+            success = false;
+
+    if (success)
+        return true;
+
+    // Close all open databases which have a registered close operation
+    while (!_close.empty())
+    {
+        _close.top()();
+        _close.pop();
+    }
+
+    return false;
+}
+
 void DatabaseMgr::CloseAllConnections()
 {
     LOG_INFO("db", "> Close all database connections...");
@@ -49,6 +49,9 @@ public:
 
     void SetModuleList(std::string_view modulesList) { _modulesList = modulesList; }
 
+    // Empty databases are populated with this many threads per database, see DBUpdater::Populate
+    void SetImportThreads(uint32 threads) { _importThreads = threads; }
+
 private:
     using Predicate = std::function<bool()>;
     using Closer = std::function<void()>;
@@ -62,9 +65,14 @@ private:
     // Returns false when there was an error.
     bool Process(std::queue<Predicate>& queue);
 
+    // Same as Process, but every function runs on its own thread
+    bool ProcessParallel(std::queue<Predicate>& queue);
+
     std::string _modulesList;
     bool _autoSetup{};
+    bool _parallelUpdates{};
     uint32 _updateFlags{};
+    uint32 _importThreads{};
 
     std::queue<Predicate> _open, _populate, _update, _prepare;
     std::stack<Closer> _close;
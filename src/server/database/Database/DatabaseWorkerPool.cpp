@@ -19,19 +19,24 @@
 #include "Config.h"
 #include "DatabaseAsyncOperation.h"
 #include "DatabaseAsyncQueueWorker.h"
+#include "DatabaseWriteBehind.h"
 #include "Errors.h"
 #include "FileUtil.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLConnection.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
+#include "Optional.h"
 #include "PCQueue.h"
 #include "PreparedStatement.h"
+#include "PreparedStatementPool.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
 #include "TaskScheduler.h"
 #include "Transaction.h"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <limits>
@@ -51,9 +56,6 @@
 #define MIN_DB_CLIENT_VERSION 50700u
 #endif
 
-constexpr auto MAX_SYNC_CONNECTIONS = 32;
-constexpr auto MAX_ASYNC_CONNECTIONS = 32;
-
 class PingOperation : public AsyncOperation
 {
 public:
@@ -87,6 +89,8 @@ DatabaseWorkerPool::DatabaseWorkerPool(DatabaseType type) :
     _queue = std::make_unique<ProducerConsumerQueue<AsyncOperation*>>();
     _asyncQueueCheckQueue = std::make_unique<ProducerConsumerQueue<CheckAsyncQueueTask*>>();
     _asyncQueueChecker = std::make_unique<AsyncDBQueueChecker>(_asyncQueueCheckQueue.get());
+    _statementPool = std::make_unique<PreparedStatementPool>();
+    _writeBehind = std::make_unique<DatabaseWriteBehind>(this);
 }
 
 DatabaseWorkerPool::~DatabaseWorkerPool()
@@ -173,14 +177,25 @@ void DatabaseWorkerPool::Close()
 
     LOG_INFO("db.pool", "Closing down DatabasePool '{}' ...", GetDatabaseName());
 
+    // Queued updates must reach the database before the connections go away
+    _writeBehind->SetEnabled(false);
+    _writeBehind->FlushAndWait();
+
     //! Closes the actually DB connection.
-    _connections[IDX_ASYNC].clear();
+    //! The checker thread may still be updating the connections
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_ASYNC]);
+        _connections[IDX_ASYNC].clear();
+    }
 
     //! Shut down the synchronous connections
     //! There's no need for locking the connection, because DatabaseWorkerPool<>::Close
     //! should only be called after any other thread tasks in the core have exited,
     //! meaning there can be no concurrent access at this point.
-    _connections[IDX_SYNCH].clear();
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_SYNCH]);
+        _connections[IDX_SYNCH].clear();
+    }
 
     LOG_INFO("db.pool", "All connections on DatabasePool '{}' closed.", GetDatabaseName());
 }
@@ -192,7 +207,7 @@ QueryResult DatabaseWorkerPool::Query(std::string_view sql)
         return { nullptr };
 
     auto result = connection->Query(sql);
-    connection->Unlock();
+    ReleaseConnection(connection);
 
     if (!result || !result->GetRowCount() || !result->NextRow())
         return { nullptr };
@@ -217,12 +232,23 @@ std::pair<uint32, MySQLConnection*> DatabaseWorkerPool::OpenConnection(InternalI
     // Init statements before add to container
     InitPrepareStatement(connection.get());
 
+    // Dynamic connections are used as soon as they are added
+    if (isDynamic && !connection->PrepareStatements())
+    {
+        LOG_ERROR("db.pool", "Can't register prepare statements for dynamic connection");
+        return { 1, nullptr };
+    }
+
     if (type == IDX_ASYNC)
         connection->SetAsyncQueue(_queue.get());
 
     // Add connection to container
+    std::lock_guard guard(_connectionsMutex[type]);
     auto& itrConnection = _connections[type].emplace_back(std::move(connection));
 
+    if (type == IDX_SYNCH)
+        _syncConnectionReleased.notify_one();
+
     // Everything is fine
     return { 0, itrConnection.get() };
 }
@@ -238,36 +264,57 @@ MySQLConnection* DatabaseWorkerPool::GetFreeConnection()
     }
 #endif
 
-    std::lock_guard guardCleanup(_cleanupMutex);
+    std::unique_lock lock(_connectionsMutex[IDX_SYNCH]);
 
-    // Check default connections
-    for (auto& connection : _connections[IDX_SYNCH])
-        if (connection->LockIfReady())
-            return connection.get();
+    Optional<TimePoint> waitStart;
+    bool warned{};
 
-    LOG_WARN("db.pool", "> Not found free sync connection. Connections count: {}", _connections[IDX_SYNCH].size());
+    //! Block until a connection is released or a new one is opened
+    for (;;)
+    {
+        for (auto& connection : _connections[IDX_SYNCH])
+        {
+            //! Must be matched with ReleaseConnection() or you will get deadlocks
+            if (!connection->LockIfReady())
+                continue;
 
-    // Try to make new connect if connections count < MAX_SYNC_CONNECTIONS
-    OpenDynamicSyncConnect();
+            if (waitStart)
+            {
+                _syncWaits.fetch_add(1, std::memory_order_relaxed);
+                _syncWaitTime.fetch_add(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - *waitStart).count(), std::memory_order_relaxed);
+            }
 
-    std::lock_guard guardOpenConnect(_openSyncConnectMutex);
+            return connection.get();
+        }
 
-    MySQLConnection* freeConnection{ nullptr };
+        if (!waitStart)
+            waitStart = std::chrono::steady_clock::now();
 
-    uint8 i{};
-    auto const num_cons{ _connections[IDX_SYNCH].size()};
+        // Try to make new connect if connections count < Database.SyncConnections.Max
+        lock.unlock();
+        bool const opened = OpenDynamicSyncConnect();
+        lock.lock();
 
-    //! Block forever until a connection is free
-    for (;;)
-    {
-        freeConnection = _connections[IDX_SYNCH][++i % num_cons].get();
+        if (opened)
+            continue;
 
-        //! Must be matched with t->Unlock() or you will get deadlocks
-        if (freeConnection->LockIfReady())
-            break;
+        if (!warned)
+        {
+            LOG_WARN("db.pool", "> Not found free sync connection. Connections count: {}", _connections[IDX_SYNCH].size());
+            warned = true;
+        }
+
+        // ReleaseConnection notifies, the timeout covers connections which could not be opened
+        _syncConnectionReleased.wait_for(lock, 100ms);
     }
+}
+
+void DatabaseWorkerPool::ReleaseConnection(MySQLConnection* connection)
+{
+    connection->Unlock();
 
-    return freeConnection;
+    std::lock_guard guard(_connectionsMutex[IDX_SYNCH]);
+    _syncConnectionReleased.notify_one();
 }
 
 std::string_view DatabaseWorkerPool::GetDatabaseName() const
@@ -295,22 +342,10 @@ void DatabaseWorkerPool::Execute(PreparedStatement stmt)
         return;
     }
 
-    Enqueue(new PreparedStatementTask(std::move(stmt)));
-}
-
-void DatabaseWorkerPool::CleanupConnections()
-{
-    std::lock_guard guard(_cleanupMutex);
-
-    _connections[IDX_SYNCH].erase(std::remove_if(_connections[IDX_SYNCH].begin(), _connections[IDX_SYNCH].end(), [](std::unique_ptr<MySQLConnection>& connection)
-    {
-        return connection->CanRemoveConnection();
-    }), _connections[IDX_SYNCH].end());
+    if (_writeBehind->Add(stmt))
+        return;
 
-    _connections[IDX_ASYNC].erase(std::remove_if(_connections[IDX_ASYNC].begin(), _connections[IDX_ASYNC].end(), [](std::unique_ptr<MySQLConnection>& connection)
-    {
-        return connection->CanRemoveConnection();
-    }), _connections[IDX_ASYNC].end());
+    Enqueue(new PreparedStatementTask(std::move(stmt)));
 }
 
 bool DatabaseWorkerPool::PrepareStatements()
@@ -374,12 +409,13 @@ bool DatabaseWorkerPool::PrepareStatements()
             if (!IsValidPrepareStatements(connection.get()))
                 return false;
 
+    _statementPool->Initialize(_preparedStatementSize.size());
     return true;
 }
 
 PreparedStatement DatabaseWorkerPool::GetPreparedStatement(uint32 index)
 {
-    return std::make_shared<PreparedStatementBase>(index, _preparedStatementSize[index]);
+    return _statementPool->Get(index, _preparedStatementSize[index]);
 }
 
 void DatabaseWorkerPool::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags)
@@ -394,6 +430,11 @@ void DatabaseWorkerPool::PrepareStatement(uint32 index, std::string_view sql, Co
     _stringPreparedStatement.emplace(index, StringPreparedStatement{ index, sql, flags });
 }
 
+void DatabaseWorkerPool::SetWriteBehind(uint32 index, std::initializer_list<uint8> keyParams)
+{
+    _writeBehind->Register(index, keyParams);
+}
+
 PreparedQueryResult DatabaseWorkerPool::Query(PreparedStatement stmt)
 {
     auto [isAllSet, notSetIndex] = stmt->IsAllParamsSet();
@@ -408,7 +449,7 @@ PreparedQueryResult DatabaseWorkerPool::Query(PreparedStatement stmt)
         return { nullptr };
 
     auto result = connection->Query(std::move(stmt));
-    connection->Unlock();
+    ReleaseConnection(connection);
 
     if (!result || !result->GetRowCount())
         return { nullptr };
@@ -494,6 +535,7 @@ TransactionCallback DatabaseWorkerPool::AsyncCommitTransaction(SQLTransaction tr
 
 void DatabaseWorkerPool::Enqueue(AsyncOperation* operation)
 {
+    operation->SetEnqueueTime(std::chrono::steady_clock::now());
     _queue->Push(operation);
 }
 
@@ -504,7 +546,7 @@ void DatabaseWorkerPool::DirectCommitTransaction(SQLTransaction transaction)
     auto errorCode = connection->ExecuteTransaction(transaction);
     if (!errorCode)
     {
-        connection->Unlock(); // OK, operation successful
+        ReleaseConnection(connection); // OK, operation successful
         return;
     }
 
@@ -524,7 +566,7 @@ void DatabaseWorkerPool::DirectCommitTransaction(SQLTransaction transaction)
 
     //! Clean up now.
     transaction->Cleanup();
-    connection->Unlock();
+    ReleaseConnection(connection);
 }
 
 void DatabaseWorkerPool::ExecuteOrAppend(SQLTransaction trans, std::string_view sql)
@@ -550,14 +592,24 @@ void DatabaseWorkerPool::DirectExecute(std::string_view sql)
 
     auto connection = GetFreeConnection();
     connection->Execute(sql);
-    connection->Unlock();
+    ReleaseConnection(connection);
 }
 
 void DatabaseWorkerPool::DirectExecute(PreparedStatement stmt)
 {
     auto connection = GetFreeConnection();
     connection->Execute(std::move(stmt));
-    connection->Unlock();
+    ReleaseConnection(connection);
+}
+
+bool DatabaseWorkerPool::DirectExecuteScript(std::vector<std::string> const& statements)
+{
+    // Dynamic only to log the connect at debug level, it never joins the pool
+    MySQLConnection connection(*_connectionInfo, ConnectionFlags::Sync, true);
+    if (connection.Open())
+        return false;
+
+    return connection.ExecuteScript(statements);
 }
 
 void DatabaseWorkerPool::EscapeString(std::string& str)
@@ -573,14 +625,20 @@ void DatabaseWorkerPool::EscapeString(std::string& str)
 
 void DatabaseWorkerPool::KeepAlive()
 {
-    std::lock_guard guard(_cleanupMutex);
+    //! Ping synchronous connection, unless it is in use anyway
+    MySQLConnection* connection{ nullptr };
+
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_SYNCH]);
+        if (_connections[IDX_SYNCH].front()->LockIfReady())
+            connection = _connections[IDX_SYNCH].front().get();
+    }
 
-    //! Ping synchronous connection
-    auto& connection = _connections[IDX_SYNCH].front();
-    if (connection->LockIfReady())
+    // The first connection is never closed, the ping runs unlocked so sync callers can take the others meanwhile
+    if (connection)
     {
         connection->Ping();
-        connection->Unlock();
+        ReleaseConnection(connection);
     }
 
     //! Ping asynchronous connection
@@ -597,7 +655,14 @@ unsigned long DatabaseWorkerPool::EscapeString(char* to, char const* from, unsig
     if (!to || !from || !length)
         return 0;
 
-    return _connections[IDX_SYNCH].front()->EscapeString(to, from, length);
+    MySQLConnection* connection{ nullptr };
+
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_SYNCH]);
+        connection = _connections[IDX_SYNCH].front().get();
+    }
+
+    return connection->EscapeString(to, from, length);
 }
 
 SQLQueryHolderCallback DatabaseWorkerPool::DelayQueryHolder(SQLQueryHolder holder)
@@ -621,6 +686,11 @@ void DatabaseWorkerPool::AddTasks()
     _maxAsyncQueueSize = sConfigMgr->GetOption<uint32>("MaxQueueSize", 10);
     ASSERT(_maxAsyncQueueSize >= 10, "Queue size can only be greater than or equal to 10");
 
+    _maxConnections[IDX_SYNCH] = std::max<std::size_t>(1, sConfigMgr->GetOption<uint32>("Database.SyncConnections.Max", 32));
+    _maxConnections[IDX_ASYNC] = std::max<std::size_t>(1, sConfigMgr->GetOption<uint32>("Database.AsyncConnections.Max", 32));
+    _maxAsyncWait = Milliseconds{ sConfigMgr->GetOption<uint32>("Database.AsyncConnections.MaxWait", 100) };
+    _connectionIdleTime = Seconds{ sConfigMgr->GetOption<uint32>("Database.DynamicConnections.IdleTime", 10) };
+
     // DB ping
     _scheduler->Schedule(Minutes{ sConfigMgr->GetOption<uint32>("MaxPingTime", 30) }, [this](TaskContext context)
     {
@@ -629,67 +699,211 @@ void DatabaseWorkerPool::AddTasks()
         context.Repeat();
     });
 
-    // Cleanup dynamic connections
-    _scheduler->Schedule(10s, [this](TaskContext context)
+    // Commit coalesced write-behind updates
+    Milliseconds const writeBehindInterval{ sConfigMgr->GetOption<uint32>("Database.WriteBehind.Interval", 1000) };
+    _writeBehind->SetEnabled(writeBehindInterval > 0ms);
+
+    if (writeBehindInterval > 0ms)
     {
-        CleanupConnections();
-        context.Repeat(1s);
-    });
+        _scheduler->Schedule(writeBehindInterval, [this](TaskContext context)
+        {
+            _writeBehind->Flush();
+            context.Repeat();
+        });
+    }
 
-    // Check queue and add dymanic async connects if need
+    // Open and close dynamic connections, runs on the checker thread so a slow connect doesn't stall the caller
     _scheduler->Schedule(1s, [this](TaskContext context)
     {
         _asyncQueueCheckQueue->Push(new CheckAsyncQueueTask(this));
-        context.Repeat(5s);
+        context.Repeat();
     });
 }
 
-void DatabaseWorkerPool::OpenDynamicAsyncConnect()
+bool DatabaseWorkerPool::OpenDynamicAsyncConnect()
 {
-    std::lock_guard guard(_openAsyncConnectMutex);
+    return OpenDynamicConnection(IDX_ASYNC);
+}
 
-    if (_connections[IDX_ASYNC].size() >= MAX_ASYNC_CONNECTIONS)
-        return;
+bool DatabaseWorkerPool::OpenDynamicSyncConnect()
+{
+    return OpenDynamicConnection(IDX_SYNCH);
+}
 
-    LOG_DEBUG("db.pool", "Add new dynamic async connection...");
+bool DatabaseWorkerPool::OpenDynamicConnection(InternalIndex type)
+{
+    {
+        std::lock_guard guard(_connectionsMutex[type]);
 
-    auto [error, connection] = OpenConnection(IDX_ASYNC, true);
-    if (error)
-        return;
+        if (_connections[type].size() + _openingConnections[type] >= _maxConnections[type])
+            return false;
+
+        // Reserve the slot, the connect itself runs unlocked
+        ++_openingConnections[type];
+    }
 
-    ASSERT(connection->PrepareStatements(), "Can't register prepare statements for dynamic async connection");
+    LOG_DEBUG("db.pool", "Add new dynamic {} connection...", type == IDX_ASYNC ? "async" : "sync");
+
+    auto [error, connection] = OpenConnection(type, true);
+
+    std::lock_guard guard(_connectionsMutex[type]);
+    --_openingConnections[type];
+    return !error;
 }
 
-void DatabaseWorkerPool::OpenDynamicSyncConnect()
+void DatabaseWorkerPool::CloseIdleSyncConnection()
 {
-    std::lock_guard guard(_openSyncConnectMutex);
+    std::unique_ptr<MySQLConnection> idleConnection;
 
-    if (_connections[IDX_SYNCH].size() >= MAX_SYNC_CONNECTIONS)
-        return;
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_SYNCH]);
+
+        auto& connections = _connections[IDX_SYNCH];
+        auto itr = std::find_if(connections.begin(), connections.end(), [this](std::unique_ptr<MySQLConnection> const& connection)
+        {
+            if (!connection->CanRemoveConnection(_connectionIdleTime))
+                return false;
+
+            // Sync connections are only locked under this mutex, so a free one can't be taken after this check
+            if (!connection->LockIfReady())
+                return false;
+
+            connection->Unlock();
+            return true;
+        });
+
+        if (itr == connections.end())
+            return;
+
+        idleConnection = std::move(*itr);
+        connections.erase(itr);
+    }
+
+    LOG_DEBUG("db.pool", "{} DBPool: Close idle dynamic sync connection", _poolName);
+}
+
+void DatabaseWorkerPool::RetireAsyncConnection()
+{
+    std::unique_ptr<MySQLConnection> retiredConnection;
+
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_ASYNC]);
+
+        // Async connections take their operations from the same queue, any dynamic one can go
+        auto& connections = _connections[IDX_ASYNC];
+        auto itr = std::find_if(connections.rbegin(), connections.rend(), [](std::unique_ptr<MySQLConnection> const& connection)
+        {
+            return connection->IsDynamic();
+        });
+
+        if (itr == connections.rend())
+            return;
+
+        retiredConnection = std::move(*itr);
+        connections.erase(std::next(itr).base());
+    }
 
-    LOG_DEBUG("db.pool", "Add new dynamic sync connection...");
+    LOG_DEBUG("db.pool", "{} DBPool: Close unneeded dynamic async connection", _poolName);
 
-    auto [error, connection] = OpenConnection(IDX_SYNCH, true);
-    if (!error)
-        ASSERT(connection->PrepareStatements());
+    // Finishes its current operation, the queued ones are left to the other connections
+    retiredConnection.reset();
 }
 
 void DatabaseWorkerPool::GetPoolInfo(std::function<void(std::string_view)> const& info)
 {
-    info(Warhead::StringFormat("Pool name: {}. Connections count (sync/async): {}/{}", GetPoolName(), _connections[IDX_SYNCH].size(), _connections[IDX_ASYNC].size()));
+    std::size_t syncCount{}, asyncCount{};
+
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_SYNCH]);
+        syncCount = _connections[IDX_SYNCH].size();
+    }
+
+    {
+        std::lock_guard guard(_connectionsMutex[IDX_ASYNC]);
+        asyncCount = _connections[IDX_ASYNC].size();
+    }
+
+    info(Warhead::StringFormat("Pool name: {}. Connections count (sync/async): {}/{}. Max (sync/async): {}/{}", GetPoolName(), syncCount, asyncCount, _maxConnections[IDX_SYNCH], _maxConnections[IDX_ASYNC]));
     info(Warhead::StringFormat("Queue size: {}. Max size: {}", GetQueueSize(), _maxAsyncQueueSize));
 }
 
-void DatabaseWorkerPool::CheckAsyncQueue()
+void DatabaseWorkerPool::UpdateConnections()
 {
-    auto queueSize{ _queue->Size() };
-    if (queueSize < _maxAsyncQueueSize)
-        return;
+    auto collectStats = [this](InternalIndex type, std::size_t& count)
+    {
+        MySQLConnectionStats total;
+
+        std::lock_guard guard(_connectionsMutex[type]);
+        count = _connections[type].size();
 
-    std::lock_guard guard(_cleanupMutex);
+        for (auto const& connection : _connections[type])
+        {
+            auto const stats = connection->TakeStats();
+            total.Operations += stats.Operations;
+            total.BusyTime += stats.BusyTime;
+            total.WaitTime += stats.WaitTime;
+            total.MaxWaitTime = std::max(total.MaxWaitTime, stats.MaxWaitTime);
+            total.Reconnects += stats.Reconnects;
+            total.Contention += stats.Contention;
+        }
+
+        return total;
+    };
 
-    LOG_WARN("db.pool", "{} DBPool: Queue overload. Size: {}. Max size: {}. Connections size: {}", _poolName, queueSize, _maxAsyncQueueSize, _connections[IDX_ASYNC].size());
+    std::size_t asyncCount{}, syncCount{};
+    auto const asyncStats = collectStats(IDX_ASYNC, asyncCount);
+    auto const syncStats = collectStats(IDX_SYNCH, syncCount);
+    auto const queueSize{ _queue->Size() };
 
-    for (std::size_t i{}; i < queueSize; i += _maxAsyncQueueSize)
-        OpenDynamicAsyncConnect();
-}
\ No newline at end of file
+    TimePoint const now = std::chrono::steady_clock::now();
+    Microseconds const interval = _lastConnectionsUpdate != TimePoint() ? std::chrono::duration_cast<Microseconds>(now - _lastConnectionsUpdate) : 0us;
+    _lastConnectionsUpdate = now;
+
+    Microseconds const asyncWait = asyncStats.Operations ? asyncStats.WaitTime / int64(asyncStats.Operations) : 0us;
+    uint64 const syncWaits = _syncWaits.exchange(0, std::memory_order_relaxed);
+    Microseconds const syncWait{ syncWaits ? _syncWaitTime.exchange(0, std::memory_order_relaxed) / syncWaits : 0 };
+
+    // Async connections grow while operations queue up or wait too long and shrink again once idle
+    if (queueSize >= _maxAsyncQueueSize || (_maxAsyncWait > 0us && asyncWait >= _maxAsyncWait))
+    {
+        LOG_WARN("db.pool", "{} DBPool: Queue overload. Size: {}. Max size: {}. Average wait: {}us. Connections size: {}", _poolName, queueSize, _maxAsyncQueueSize, asyncWait.count(), asyncCount);
+
+        for (std::size_t i{}; i < std::max<std::size_t>(1, queueSize / _maxAsyncQueueSize); ++i)
+            if (!OpenDynamicAsyncConnect())
+                break;
+    }
+    else
+    {
+        // The connections share one queue so none of them is ever idle on its own. Shrink once the busy time of
+        // the pool would have kept one connection less at most half busy, for the idle time in a row.
+        bool const underused = asyncCount > 1 && interval > 0us && queueSize < _maxAsyncQueueSize / 2
+            && (_maxAsyncWait == 0us || asyncWait < _maxAsyncWait / 2)
+            && asyncStats.BusyTime * 2 < interval * int64(asyncCount - 1);
+
+        if (!underused)
+            _asyncUnderusedSince = TimePoint();
+        else if (_asyncUnderusedSince == TimePoint())
+            _asyncUnderusedSince = now;
+        else if (now - _asyncUnderusedSince >= _connectionIdleTime)
+            RetireAsyncConnection();
+    }
+
+    // Sync connections are opened by waiting callers, close them once nobody had to wait
+    if (!syncWaits)
+        CloseIdleSyncConnection();
+
+    METRIC_VALUE("db_queue_size", uint64(queueSize), METRIC_TAG("pool", _poolName));
+
+    auto sendMetrics = [this](std::string_view type, std::size_t count, MySQLConnectionStats const& stats, Microseconds wait)
+    {
+        METRIC_VALUE("db_connections", uint64(count), METRIC_TAG("pool", _poolName), METRIC_TAG("type", std::string(type)));
+        METRIC_VALUE("db_wait", uint64(wait.count()), METRIC_TAG("pool", _poolName), METRIC_TAG("type", std::string(type)));
+        METRIC_VALUE("db_operations", stats.Operations, METRIC_TAG("pool", _poolName), METRIC_TAG("type", std::string(type)));
+        METRIC_VALUE("db_busy_time", uint64(stats.BusyTime.count()), METRIC_TAG("pool", _poolName), METRIC_TAG("type", std::string(type)));
+        METRIC_VALUE("db_reconnects", stats.Reconnects, METRIC_TAG("pool", _poolName), METRIC_TAG("type", std::string(type)));
+        METRIC_VALUE("db_contention", stats.Contention, METRIC_TAG("pool", _poolName), METRIC_TAG("type", std::string(type)));
+    };
+
+    sendMetrics("async", asyncCount, asyncStats, asyncWait);
+    sendMetrics("sync", syncCount, syncStats, syncWait);
+}
@@ -22,7 +22,10 @@
 #include "Duration.h"
 #include "StringFormat.h"
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <initializer_list>
 #include <mutex>
 #include <thread>
 #include <unordered_map>
@@ -34,6 +37,8 @@ class ProducerConsumerQueue;
 class AsyncDBQueueChecker;
 class AsyncOperation;
 class CheckAsyncQueueTask;
+class DatabaseWriteBehind;
+class PreparedStatementPool;
 class TaskScheduler;
 
 struct StringPreparedStatement
@@ -117,6 +122,12 @@ public:
     //! Statement must be prepared with the ConnectionFlags::Sync flag.
     void DirectExecute(PreparedStatement stmt);
 
+    //! Directly executes the statements of a sql file, that will block the calling thread until finished.
+    //! Returns false at the first failing statement, the error is logged but not handled. Statements before it are
+    //! not undone, see MySQLConnection::ExecuteScript. The file runs on its own connection, which is closed
+    //! afterwards, so session variables it sets don't reach the pooled connections.
+    bool DirectExecuteScript(std::vector<std::string> const& statements);
+
     /**
         Synchronous query (with resultset) methods.
     */
@@ -192,15 +203,12 @@ public:
     */
 
     //! Auto managed (internally) pointer to a prepared statement object for usage in upper level code.
-    //! Pointer is deleted in this->DirectExecute(PreparedStatementBase*), this->Query(PreparedStatementBase*) or PreparedStatementTask::~PreparedStatementTask.
+    //! Once the last reference outside the pool is released, the object is handed out again by a later call with the same index.
     //! This object is not tied to the prepared statement on the MySQL context yet until execution.
     PreparedStatement GetPreparedStatement(uint32 index);
 
     void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
 
-    // Close dynamic connections if need
-    void CleanupConnections();
-
     //! Apply escape string'ing for current collation. (utf8)
     void EscapeString(std::string& str);
 
@@ -223,18 +231,25 @@ public:
     void Update(Milliseconds diff);
     [[nodiscard]] std::size_t GetQueueSize() const;
 
-    void OpenDynamicAsyncConnect();
-    void OpenDynamicSyncConnect();
+    //! Open a dynamic connection unless the configured maximum is reached, returns false if none was opened
+    bool OpenDynamicAsyncConnect();
+    bool OpenDynamicSyncConnect();
 
     void GetPoolInfo(std::function<void(std::string_view)> const& info);
 
     inline std::string_view GetPathToExtraFile() { return _pathToExtraFile; }
 
     void CheckCleanup();
-    void CheckAsyncQueue();
+
+    //! Opens or closes dynamic connections depending on the queue size and the measured wait time
+    //! and sends the pool metrics. Runs on the async queue checker thread.
+    void UpdateConnections();
 
 protected:
     inline void SetStatementSize(std::size_t statementSize) { _statementSize = statementSize; }
+
+    //! Statements passed to Execute(PreparedStatement) are coalesced by keyParams and committed in batches, see DatabaseWriteBehind
+    void SetWriteBehind(uint32 index, std::initializer_list<uint8> keyParams);
     inline std::size_t GetStatementSize() const { return _statementSize; }
 
     std::size_t _statementSize{};
@@ -247,10 +262,22 @@ private:
     void AddTasks();
     void MakeExtraFile();
 
-    //! Gets a free connection in the synchronous connection pool.
-    //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
+    //! Gets a free connection in the synchronous connection pool, waits for one if all of them are busy
+    //! and no more may be opened.
+    //! Caller MUST call ReleaseConnection() after touching the MySQL context to prevent deadlocks.
     MySQLConnection* GetFreeConnection();
 
+    //! Unlocks a connection returned by GetFreeConnection and wakes up a waiting caller
+    void ReleaseConnection(MySQLConnection* connection);
+
+    bool OpenDynamicConnection(InternalIndex type);
+
+    //! Closes at most one dynamic sync connection unused for the idle time
+    void CloseIdleSyncConnection();
+
+    //! Closes one dynamic async connection, see UpdateConnections
+    void RetireAsyncConnection();
+
     // Get using db name from connection info
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
@@ -258,9 +285,11 @@ private:
     std::array<std::vector<std::unique_ptr<MySQLConnection>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
-    std::mutex _openSyncConnectMutex;
-    std::mutex _openAsyncConnectMutex;
-    std::mutex _cleanupMutex;
+    std::unique_ptr<PreparedStatementPool> _statementPool;
+    std::unique_ptr<DatabaseWriteBehind> _writeBehind;
+    std::array<std::mutex, IDX_SIZE> _connectionsMutex;                 // guards _connections and _openingConnections of the same type
+    std::array<std::size_t, IDX_SIZE> _openingConnections{};
+    std::condition_variable _syncConnectionReleased;
     std::string _poolName;
     std::string _pathToExtraFile;
     DatabaseType _poolType{ DatabaseType::None };
@@ -272,6 +301,19 @@ private:
     std::unique_ptr<AsyncDBQueueChecker> _asyncQueueChecker;
     std::size_t _maxAsyncQueueSize{ 10 };
 
+    // Dynamic connections
+    std::array<std::size_t, IDX_SIZE> _maxConnections{ 32, 32 };
+    Microseconds _maxAsyncWait{ 100ms };
+    Milliseconds _connectionIdleTime{ 10s };
+
+    // Checker thread only, see UpdateConnections
+    TimePoint _lastConnectionsUpdate;
+    TimePoint _asyncUnderusedSince;
+
+    // Time sync callers spent waiting for a free connection, see UpdateConnections
+    std::atomic<uint64> _syncWaitTime{};
+    std::atomic<uint64> _syncWaits{};
+
 #ifdef WARHEAD_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
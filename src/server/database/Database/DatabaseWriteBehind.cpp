@@ -0,0 +1,148 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "DatabaseWriteBehind.h"
+#include "DatabaseWorkerPool.h"
+#include "Duration.h"
+#include "Errors.h"
+#include "Log.h"
+#include "PreparedStatement.h"
+#include "Transaction.h"
+
+void DatabaseWriteBehind::Register(uint32 index, std::initializer_list<uint8> keyParams)
+{
+    ASSERT(keyParams.size(), "> Write-behind statement {} needs at least one key parameter", index);
+
+    if (_keyParams.size() <= index)
+        _keyParams.resize(index + 1);
+
+    _keyParams[index] = keyParams;
+}
+
+bool DatabaseWriteBehind::Add(PreparedStatement const& stmt)
+{
+    uint32 const index = stmt->GetIndex();
+    if (!_enabled || index >= _keyParams.size() || _keyParams[index].empty())
+        return false;
+
+    std::string key = MakeKey(*stmt);
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto [itr, inserted] = _queueKeys.try_emplace(std::move(key), _queue.size());
+    if (inserted)
+        _queue.emplace_back(stmt);
+    else
+    {
+        // Keeps the position of the first update, nothing queued after it touches the same row
+        _queue[itr->second] = stmt;
+        ++_coalesced;
+    }
+
+    return true;
+}
+
+void DatabaseWriteBehind::Flush()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    if (_inFlight)
+    {
+        if (_inFlight->wait_for(0s) != std::future_status::ready)
+            return;
+
+        _inFlight.reset();
+    }
+
+    if (_queue.empty())
+        return;
+
+    LOG_DEBUG("db.pool", "{} DBPool: Write-behind flush of {} statements, {} updates coalesced", _pool->GetPoolName(), _queue.size(), _coalesced);
+
+    _inFlight = _pool->AsyncCommitTransaction(TakeQueued())._future;
+}
+
+void DatabaseWriteBehind::FlushAndWait()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    if (_inFlight)
+    {
+        _inFlight->wait();
+        _inFlight.reset();
+    }
+
+    if (_queue.empty())
+        return;
+
+    LOG_INFO("db.pool", "{} DBPool: Writing {} queued write-behind statements", _pool->GetPoolName(), _queue.size());
+    _pool->DirectCommitTransaction(TakeQueued());
+}
+
+std::size_t DatabaseWriteBehind::GetQueueSize() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _queue.size();
+}
+
+SQLTransaction DatabaseWriteBehind::TakeQueued()
+{
+    SQLTransaction trans = _pool->BeginTransaction();
+
+    for (PreparedStatement& stmt : _queue)
+        trans->Append(std::move(stmt));
+
+    _queue.clear();
+    _queueKeys.clear();
+    _coalesced = 0;
+    return trans;
+}
+
+std::string DatabaseWriteBehind::MakeKey(PreparedStatementBase const& stmt) const
+{
+    uint32 const index = stmt.GetIndex();
+
+    std::string key;
+    key.append(reinterpret_cast<char const*>(&index), sizeof(index));
+
+    for (uint8 param : _keyParams[index])
+    {
+        ASSERT(param < stmt.GetParameters().size());
+
+        std::visit([&key](auto const& value)
+        {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_arithmetic_v<T>)
+                key.append(reinterpret_cast<char const*>(&value), sizeof(value));
+            else if constexpr (std::is_same_v<T, std::nullptr_t>)
+                key.push_back('\0');
+            else
+            {
+                uint32 const size = uint32(value.size());
+                key.append(reinterpret_cast<char const*>(&size), sizeof(size));
+                key.append(reinterpret_cast<char const*>(value.data()), value.size());
+            }
+        }, stmt.GetParameters()[param].data);
+    }
+
+    return key;
+}
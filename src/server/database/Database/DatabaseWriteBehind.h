@@ -0,0 +1,80 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _DATABASEWRITEBEHIND_H
+#define _DATABASEWRITEBEHIND_H
+
+#include "DatabaseEnvFwd.h"
+#include "Optional.h"
+#include <atomic>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class DatabaseWorkerPool;
+
+/// Write-behind for single row updates which are executed often, e.g. on every zone change.
+/// Registered statements passed to DatabaseWorkerPool::Execute are queued instead and committed
+/// together as one transaction by Flush. A queued statement is replaced by a later one with the same
+/// index and key parameters, so only the latest value of a row is written.
+/// Only one flush runs at a time, so updates of a key are applied in the order they were executed.
+class WH_DATABASE_API DatabaseWriteBehind
+{
+public:
+    explicit DatabaseWriteBehind(DatabaseWorkerPool* pool) : _pool(pool) { }
+    ~DatabaseWriteBehind() = default;
+
+    /// keyParams are the parameter indexes identifying the row, usually those of the WHERE clause.
+    /// The statement must set the row to absolute values, incremental updates can't be coalesced.
+    void Register(uint32 index, std::initializer_list<uint8> keyParams);
+
+    void SetEnabled(bool enabled) { _enabled = enabled; }
+
+    /// Returns false if stmt is not registered for write-behind and must be executed as usual
+    bool Add(PreparedStatement const& stmt);
+
+    /// Commits the queued statements asynchronously, unless the previous flush is still running
+    void Flush();
+
+    /// Waits for the running flush and commits everything queued synchronously. Used on shutdown.
+    void FlushAndWait();
+
+    [[nodiscard]] std::size_t GetQueueSize() const;
+
+private:
+    SQLTransaction TakeQueued();
+    [[nodiscard]] std::string MakeKey(PreparedStatementBase const& stmt) const;
+
+    DatabaseWorkerPool* _pool;
+    std::atomic<bool> _enabled{ false };
+
+    std::vector<std::vector<uint8>> _keyParams;     // by statement index, empty if not registered
+
+    mutable std::mutex _lock;
+    std::vector<PreparedStatement> _queue;
+    std::unordered_map<std::string, std::size_t> _queueKeys;
+    Optional<TransactionFuture> _inFlight;
+    uint64 _coalesced{};
+
+    DatabaseWriteBehind(DatabaseWriteBehind const& right) = delete;
+    DatabaseWriteBehind& operator=(DatabaseWriteBehind const& right) = delete;
+};
+
+#endif
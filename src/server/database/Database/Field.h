@@ -86,6 +86,9 @@ class WH_DATABASE_API Field
     friend class ResultSet;
     friend class PreparedResultSet;
 
+    template<typename T>
+    friend class ColumnDecoder;
+
 public:
     Field();
     ~Field() = default;
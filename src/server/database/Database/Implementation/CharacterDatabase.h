@@ -194,6 +194,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_EQUIP_SET,
 
     CHAR_INS_AURA,
+    CHAR_REP_AURA,
+    CHAR_DEL_CHAR_AURA_BY_CASTER_SPELL,
 
     CHAR_SEL_ACCOUNT_DATA,
     CHAR_REP_ACCOUNT_DATA,
@@ -234,7 +236,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_ALL_PETITION_SIGNATURES,
     CHAR_DEL_PETITION_SIGNATURE,
 
-    CHAR_INS_PLAYER_ENTRY_POINT,
+    CHAR_REP_PLAYER_ENTRY_POINT,
     CHAR_DEL_PLAYER_ENTRY_POINT,
 
     CHAR_INS_PLAYER_HOMEBIND,
@@ -362,11 +364,10 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_GUILD_BANK_ITEM_BY_ENTRY,
     CHAR_DEL_CHAR_ACHIEVEMENT,
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS,
-    CHAR_INS_CHAR_ACHIEVEMENT,
+    CHAR_REP_CHAR_ACHIEVEMENT,
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA,
-    CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS,
-    CHAR_DEL_CHAR_REPUTATION_BY_FACTION,
-    CHAR_INS_CHAR_REPUTATION_BY_FACTION,
+    CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS,
+    CHAR_REP_CHAR_REPUTATION_BY_FACTION,
     CHAR_UPD_CHAR_ARENA_POINTS,
     CHAR_DEL_ITEM_REFUND_INSTANCE,
     CHAR_INS_ITEM_REFUND_INSTANCE,
@@ -441,8 +442,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_INS_CHAR_SKILLS,
     CHAR_UDP_CHAR_SKILLS,
     CHAR_INS_CHAR_SPELL,
-    CHAR_DEL_CHAR_STATS,
-    CHAR_INS_CHAR_STATS,
+    CHAR_REP_CHAR_STATS,
     CHAR_SEL_CHAR_STATS,
     CHAR_DEL_PETITION_BY_OWNER,
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER,
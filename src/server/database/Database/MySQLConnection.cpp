@@ -37,7 +37,6 @@
 namespace
 {
     constexpr auto DB_DEFAULT_CHARSET = "utf8mb4";
-    constexpr auto DYNAMIC_CONNECTION_TIMEOUT = 1s;
 
     std::string GetConnectionFlagString(ConnectionFlags flag)
     {
@@ -404,6 +403,8 @@ bool MySQLConnection::HandleMySQLError(uint32 errNo, uint8 attempts /*= 5*/)
                     ABORT("Could not re-prepare statements!");
                 }
 
+                _reconnects.fetch_add(1, std::memory_order_relaxed);
+
                 LOG_INFO("db.connection", "Successfully reconnected to {} @{}:{} Connection flags: {}.",
                     _connectionInfo.Database, _connectionInfo.Host, _connectionInfo.PortOrSocket, (uint8)_connectionFlags);
 
@@ -516,6 +517,49 @@ void MySQLConnection::CommitTransaction()
     Execute("COMMIT");
 }
 
+bool MySQLConnection::ExecuteScript(std::vector<std::string> const& statements)
+{
+    if (!_mysqlHandle)
+        return false;
+
+    auto execute = [this](std::string_view sql)
+    {
+        if (!mysql_real_query(_mysqlHandle, sql.data(), sql.size()))
+        {
+            // Results of statements like SELECT or CALL must be read before the next one
+            int status{};
+
+            do
+            {
+                if (MYSQL_RES* result = mysql_store_result(_mysqlHandle))
+                    mysql_free_result(result);
+            } while ((status = mysql_next_result(_mysqlHandle)) == 0);
+
+            if (status < 0)
+                return true;
+        }
+
+        LOG_ERROR("db.query", "[{}] {}", mysql_errno(_mysqlHandle), mysql_error(_mysqlHandle));
+        LOG_ERROR("db.query", "Query: {}", sql);
+        return false;
+    };
+
+    if (!execute("START TRANSACTION"))
+        return false;
+
+    for (auto const& statement : statements)
+    {
+        if (!execute(statement))
+        {
+            execute("ROLLBACK");
+            return false;
+        }
+    }
+
+    UpdateLastUseTime();
+    return execute("COMMIT");
+}
+
 int32 MySQLConnection::ExecuteTransaction(SQLTransaction transaction)
 {
     auto const& queries = transaction->GetQueries();
@@ -609,13 +653,41 @@ uint32 MySQLConnection::GetServerVersion() const
     return mysql_get_server_version(_mysqlHandle);
 }
 
-bool MySQLConnection::CanRemoveConnection()
+bool MySQLConnection::CanRemoveConnection(Milliseconds idleTime)
 {
     if (!IsDynamic())
         return false;
 
     Milliseconds diff = std::chrono::duration_cast<Milliseconds>(std::chrono::system_clock::now() - _lastUseTime);
-    return diff >= DYNAMIC_CONNECTION_TIMEOUT;
+    return diff >= idleTime;
+}
+
+void MySQLConnection::AddBusyTime(Microseconds busyTime)
+{
+    _operations.fetch_add(1, std::memory_order_relaxed);
+    _busyTime.fetch_add(busyTime.count(), std::memory_order_relaxed);
+}
+
+void MySQLConnection::AddAsyncOperation(Microseconds waitTime, Microseconds busyTime)
+{
+    AddBusyTime(busyTime);
+    _waitTime.fetch_add(waitTime.count(), std::memory_order_relaxed);
+
+    // Only the worker of this connection writes it, the pool only resets it
+    if (uint64(waitTime.count()) > _maxWaitTime.load(std::memory_order_relaxed))
+        _maxWaitTime.store(waitTime.count(), std::memory_order_relaxed);
+}
+
+MySQLConnectionStats MySQLConnection::TakeStats()
+{
+    MySQLConnectionStats stats;
+    stats.Operations = _operations.exchange(0, std::memory_order_relaxed);
+    stats.BusyTime = Microseconds(_busyTime.exchange(0, std::memory_order_relaxed));
+    stats.WaitTime = Microseconds(_waitTime.exchange(0, std::memory_order_relaxed));
+    stats.MaxWaitTime = Microseconds(_maxWaitTime.exchange(0, std::memory_order_relaxed));
+    stats.Reconnects = _reconnects.exchange(0, std::memory_order_relaxed);
+    stats.Contention = _contention.exchange(0, std::memory_order_relaxed);
+    return stats;
 }
 
 void MySQLConnection::SetAsyncQueue(ProducerConsumerQueue<AsyncOperation*>* dbQueue)
@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -46,6 +47,17 @@ struct WH_DATABASE_API MySQLConnectionInfo
     std::string SSL;
 };
 
+/// Counters collected since the previous MySQLConnection::TakeStats call
+struct MySQLConnectionStats
+{
+    uint64 Operations{};
+    Microseconds BusyTime{};    // sync: time the connection was locked, async: time spent executing operations
+    Microseconds WaitTime{};    // async only: time operations spent in the queue
+    Microseconds MaxWaitTime{};
+    uint64 Reconnects{};
+    uint64 Contention{};        // LockIfReady calls that found the connection busy
+};
+
 class WH_DATABASE_API MySQLConnection
 {
 public:
@@ -72,6 +84,11 @@ public:
     void RollbackTransaction();
     void CommitTransaction();
     int32 ExecuteTransaction(SQLTransaction transaction);
+
+    /// Executes the statements of a sql file and stops at the first failing one. They run inside a transaction,
+    /// but statements like CREATE or ALTER commit implicitly, so a failure doesn't undo the ones before.
+    /// Errors are only logged, unlike Execute a broken file never terminates the process.
+    bool ExecuteScript(std::vector<std::string> const& statements);
     std::size_t EscapeString(char* to, const char* from, std::size_t length);
     void Ping();
 
@@ -79,17 +96,37 @@ public:
 
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
-    inline bool LockIfReady() { return _mutex.try_lock(); }
+    inline bool LockIfReady()
+    {
+        if (!_mutex.try_lock())
+        {
+            _contention.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        _lockTime = std::chrono::steady_clock::now();
+        return true;
+    }
 
     /// Called by parent database pool. Will let other threads access this connection
-    inline void Unlock() { return _mutex.unlock(); }
+    inline void Unlock()
+    {
+        AddBusyTime(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - _lockTime));
+        _mutex.unlock();
+    }
+
+    /// Called by the async worker after each operation
+    void AddAsyncOperation(Microseconds waitTime, Microseconds busyTime);
+
+    /// Returns the counters and starts new ones
+    MySQLConnectionStats TakeStats();
 
     static std::string_view GetClientInfo();
     std::string_view GetServerInfo();
     [[nodiscard]] uint32 GetServerVersion() const;
 
     [[nodiscard]] inline bool IsDynamic() const { return _isDynamic; }
-    [[nodiscard]] bool CanRemoveConnection();
+    [[nodiscard]] bool CanRemoveConnection(Milliseconds idleTime);
 
     void SetAsyncQueue(ProducerConsumerQueue<AsyncOperation*>* dbQueue);
 
@@ -98,6 +135,7 @@ private:
     bool Query(PreparedStatement stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
     bool HandleMySQLError(uint32 errNo, uint8 attempts = 5);
     inline void UpdateLastUseTime() { _lastUseTime = std::chrono::system_clock::now(); }
+    void AddBusyTime(Microseconds busyTime);
 
     MySQLHandle* _mysqlHandle{ nullptr };
     MySQLConnectionInfo& _connectionInfo;
@@ -107,6 +145,16 @@ private:
     bool _isDynamic{};
     bool _prepareError{}; //! Was there any error while preparing statements?
     SystemTimePoint _lastUseTime;
+    TimePoint _lockTime;
+
+    // Stats, see TakeStats
+    std::atomic<uint64> _operations{};
+    std::atomic<uint64> _busyTime{};
+    std::atomic<uint64> _waitTime{};
+    std::atomic<uint64> _maxWaitTime{};
+    std::atomic<uint64> _reconnects{};
+    std::atomic<uint64> _contention{};
+
     std::unique_ptr<AsyncDBQueueWorker> _asyncQueueWorker;
 
     MySQLConnection(MySQLConnection const& right) = delete;
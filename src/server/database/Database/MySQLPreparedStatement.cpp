@@ -45,6 +45,7 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view
     /// Initialize variable parameters
     _paramCount = mysql_stmt_param_count(stmt);
     _paramsSet.assign(_paramCount, false);
+    _buffers.resize(_paramCount);
 
     _bind = new MySQLBind[_paramCount];
     memset(_bind, 0, sizeof(MySQLBind) * _paramCount);
@@ -92,12 +93,13 @@ void MySQLPreparedStatement::ClearParameters()
 {
     for (uint32 i = 0; i < _paramCount; ++i)
     {
-        delete _bind[i].length;
         _bind[i].length = nullptr;
-        delete[] (char*)_bind[i].buffer;
         _bind[i].buffer = nullptr;
         _paramsSet[i] = false;
     }
+
+    // Binds may point into the statement, drop them first. Releasing it lets the pool reuse the statement.
+    _stmt.reset();
 }
 
 static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
@@ -123,16 +125,15 @@ void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
     AssertValidIndex(index);
     _paramsSet[index] = true;
     MYSQL_BIND* param = &_bind[index];
-    auto len = uint32(sizeof(T));
+    static_assert(sizeof(T) <= sizeof(ParameterBuffer::Value));
     param->buffer_type = MySQLType<T>::value;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
+    param->buffer = &_buffers[index].Value;
     param->buffer_length = 0;
     param->is_null_value = 0;
     param->length = nullptr; // Only != NULL for strings
     param->is_unsigned = std::is_unsigned_v<T>;
 
-    memcpy(param->buffer, &value, len);
+    memcpy(param->buffer, &value, sizeof(T));
 }
 
 void MySQLPreparedStatement::SetParameter(uint8 index, bool value)
@@ -146,46 +147,35 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::nullptr_t /*value*/)
     _paramsSet[index] = true;
     MYSQL_BIND* param = &_bind[index];
     param->buffer_type = MYSQL_TYPE_NULL;
-    delete[] static_cast<char*>(param->buffer);
     param->buffer = nullptr;
     param->buffer_length = 0;
     param->is_null_value = 1;
-    delete param->length;
     param->length = nullptr;
 }
 
 void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
 {
-    AssertValidIndex(index);
-    _paramsSet[index] = true;
-    MYSQL_BIND* param = &_bind[index];
-    auto len = uint32(value.size());
-    param->buffer_type = MYSQL_TYPE_VAR_STRING;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
-    param->buffer_length = len;
-    param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
-
-    memcpy(param->buffer, value.c_str(), len);
+    SetBufferParameter(index, MYSQL_TYPE_VAR_STRING, value.data(), value.size());
 }
 
 void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const& value)
+{
+    SetBufferParameter(index, MYSQL_TYPE_BLOB, value.data(), value.size());
+}
+
+void MySQLPreparedStatement::SetBufferParameter(uint8 index, enum_field_types type, void const* data, std::size_t size)
 {
     AssertValidIndex(index);
     _paramsSet[index] = true;
     MYSQL_BIND* param = &_bind[index];
-    auto len = uint32(value.size());
-    param->buffer_type = MYSQL_TYPE_BLOB;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
-    param->buffer_length = len;
+    ParameterBuffer& buffer = _buffers[index];
+    buffer.Length = static_cast<unsigned long>(size);
+    param->buffer_type = type;
+    // Only read by mysql_stmt_execute, while _stmt holds the value. An empty vector may have no data at all.
+    param->buffer = size ? const_cast<void*>(data) : &buffer.Value;
+    param->buffer_length = buffer.Length;
     param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
-
-    memcpy(param->buffer, value.data(), len);
+    param->length = &buffer.Length;
 }
 
 std::string MySQLPreparedStatement::getQueryString() const
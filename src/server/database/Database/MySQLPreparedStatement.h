@@ -50,6 +50,8 @@ protected:
     template<typename T>
     void SetParameter(uint8 index, T value);
 
+    void SetBufferParameter(uint8 index, enum_field_types type, void const* data, std::size_t size);
+
     MySQLStmt* GetSTMT() { return _mysqlStmt; }
     MySQLBind* GetBind() { return _bind; }
     PreparedStatement _stmt;
@@ -62,6 +64,16 @@ private:
     uint32 _paramCount{};
     std::vector<bool> _paramsSet;
     MySQLBind* _bind{ nullptr };
+
+    //- Storage the binds point to. Numeric values are copied here, strings and binaries
+    //- are bound in place from the PreparedStatementBase kept alive by _stmt.
+    struct ParameterBuffer
+    {
+        uint64 Value{};
+        unsigned long Length{};
+    };
+
+    std::vector<ParameterBuffer> _buffers;
     std::string _queryString;
 
     MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
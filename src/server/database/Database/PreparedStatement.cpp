@@ -20,6 +20,7 @@
 
 #include "PreparedStatement.h"
 #include "Errors.h"
+#include <algorithm>
 
 PreparedStatementBase::PreparedStatementBase(uint32 index, uint8 capacity) :
     _index(index),
@@ -33,7 +34,13 @@ template<typename T>
 Warhead::Types::is_non_string_view_v<T> PreparedStatementBase::SetValidData(const uint8 index, T const& value)
 {
     ASSERT(index < _statementData.size());
-    _statementData[index].data.emplace<T>(value);
+
+    // Assigning to the held alternative keeps its capacity, a reused statement doesn't allocate again
+    if (auto current = std::get_if<T>(&_statementData[index].data))
+        *current = value;
+    else
+        _statementData[index].data.emplace<T>(value);
+
     _paramsSet[index] = true;
 }
 
@@ -48,7 +55,24 @@ void PreparedStatementBase::SetValidData(const uint8 index)
 void PreparedStatementBase::SetValidData(const uint8 index, std::string_view value)
 {
     ASSERT(index < _statementData.size(), "> Incorrect index ({}). Statement data size: {}", index, _statementData.size());
-    _statementData[index].data.emplace<std::string>(value);
+
+    if (auto current = std::get_if<std::string>(&_statementData[index].data))
+        current->assign(value);
+    else
+        _statementData[index].data.emplace<std::string>(value);
+
+    _paramsSet[index] = true;
+}
+
+void PreparedStatementBase::SetValidData(const uint8 index, uint8 const* data, std::size_t size)
+{
+    ASSERT(index < _statementData.size());
+
+    if (auto current = std::get_if<std::vector<uint8>>(&_statementData[index].data))
+        current->assign(data, data + size);
+    else
+        _statementData[index].data.emplace<std::vector<uint8>>(data, data + size);
+
     _paramsSet[index] = true;
 }
 
@@ -65,6 +89,11 @@ template WH_DATABASE_API void PreparedStatementBase::SetValidData(const uint8 in
 template WH_DATABASE_API void PreparedStatementBase::SetValidData(const uint8 index, std::string const& value);
 template WH_DATABASE_API void PreparedStatementBase::SetValidData(const uint8 index, std::vector<uint8> const& value);
 
+void PreparedStatementBase::Reset()
+{
+    std::fill(_paramsSet.begin(), _paramsSet.end(), false);
+}
+
 std::pair<bool, uint8> PreparedStatementBase::IsAllParamsSet() const
 {
     for (std::size_t index{}; index < _paramsSet.size(); index++)
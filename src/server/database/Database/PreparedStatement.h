@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include <array>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -57,6 +58,8 @@ struct PreparedStatementData
         std::nullptr_t
     > data;
 
+    bool operator==(PreparedStatementData const& right) const = default;
+
     template<typename T>
     static std::string ToString(T value);
 
@@ -100,8 +103,7 @@ public:
     template<std::size_t Size>
     inline void SetData(const uint8 index, std::array<uint8, Size> const& value)
     {
-        std::vector<uint8> vec(value.begin(), value.end());
-        SetValidData(index, vec);
+        SetValidData(index, value.data(), value.size());
     }
 
     // Set duration
@@ -122,12 +124,16 @@ public:
     [[nodiscard]] std::vector<PreparedStatementData> const& GetParameters() const { return _statementData; }
     [[nodiscard]] std::pair<bool, uint8> IsAllParamsSet() const;
 
+    //- Marks all parameters as unset, keeping the storage of string and binary values for reuse
+    void Reset();
+
 protected:
     template<typename T>
     Warhead::Types::is_non_string_view_v<T> SetValidData(uint8 index, T const& value);
 
     void SetValidData(uint8 index);
     void SetValidData(uint8 index, std::string_view value);
+    void SetValidData(uint8 index, uint8 const* data, std::size_t size);
 
     template<typename... Ts>
     void SetDataTuple(std::tuple<Ts...> const& argsList)
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "PreparedStatementPool.h"
+#include "PreparedStatement.h"
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    // Statements of one index kept for reuse. Beyond that (a long async queue) new ones are not pooled.
+    constexpr std::size_t MAX_POOLED_STATEMENTS = 64;
+
+    // Free statements are found near the cursor, since they are handed out and released in about the same order
+    constexpr std::size_t MAX_SCANNED_STATEMENTS = 4;
+}
+
+void PreparedStatementPool::Initialize(std::size_t statementCount)
+{
+    for (std::size_t i = _slots.size(); i < statementCount; ++i)
+        _slots.emplace_back(std::make_unique<Slot>());
+}
+
+PreparedStatement PreparedStatementPool::Get(uint32 index, uint8 paramCount)
+{
+    if (index >= _slots.size())
+        return std::make_shared<PreparedStatementBase>(index, paramCount);
+
+    Slot& slot = *_slots[index];
+    std::lock_guard<std::mutex> guard(slot.Lock);
+
+    std::size_t const count = slot.Statements.size();
+    for (std::size_t i = 0; i < std::min(count, MAX_SCANNED_STATEMENTS); ++i)
+    {
+        PreparedStatement& stmt = slot.Statements[(slot.Cursor + i) % count];
+        if (stmt.use_count() != 1)
+            continue;
+
+        // Pairs with the release of the last other reference, everything it wrote to the statement is visible now
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        slot.Cursor = (slot.Cursor + i + 1) % count;
+        stmt->Reset();
+        return stmt;
+    }
+
+    PreparedStatement stmt = std::make_shared<PreparedStatementBase>(index, paramCount);
+
+    if (count < MAX_POOLED_STATEMENTS)
+        slot.Statements.emplace_back(stmt);
+
+    return stmt;
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _PREPAREDSTATEMENTPOOL_H
+#define _PREPAREDSTATEMENTPOOL_H
+
+#include "DatabaseEnvFwd.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// Recycles PreparedStatementBase objects per statement index. A statement is handed out again
+/// once nobody but the pool references it, so its parameter storage (sized once from the
+/// prepared statement's parameter count) and the capacity of its string/binary parameters are reused.
+class WH_DATABASE_API PreparedStatementPool
+{
+public:
+    PreparedStatementPool() = default;
+    ~PreparedStatementPool() = default;
+
+    /// Must be called before any Get(), statements with a higher index are never pooled
+    void Initialize(std::size_t statementCount);
+
+    [[nodiscard]] PreparedStatement Get(uint32 index, uint8 paramCount);
+
+private:
+    struct Slot
+    {
+        std::mutex Lock;
+        std::vector<PreparedStatement> Statements;
+        std::size_t Cursor{};
+    };
+
+    std::vector<std::unique_ptr<Slot>> _slots;
+
+    PreparedStatementPool(PreparedStatementPool const& right) = delete;
+    PreparedStatementPool& operator=(PreparedStatementPool const& right) = delete;
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MySQLHacks.h"
+#include <cstring>
 
 namespace
 {
@@ -181,6 +182,20 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(ResultSetRows rows) :
+    _fieldMetadata(std::move(rows.FieldMetadata)),
+    _rowCount(rows.RowCount),
+    _fieldCount(uint32(_fieldMetadata.size())),
+    _result(nullptr),
+    _fields(nullptr),
+    _storedRows(std::move(rows))
+{
+    _currRow = std::make_unique<Field[]>(_fieldCount);
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -189,7 +204,7 @@ ResultSet::~ResultSet()
 bool ResultSet::NextRow()
 {
     if (!_result)
-        return false;
+        return NextStoredRow();
 
     auto row = mysql_fetch_row(_result);
     if (!row)
@@ -212,10 +227,63 @@ bool ResultSet::NextRow()
     return true;
 }
 
+bool ResultSet::NextStoredRow()
+{
+    std::string_view data{ _storedRows.Data };
+
+    if (_storedPosition >= data.size())
+        return false;
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+    {
+        uint32 length{};
+        ASSERT(_storedPosition + sizeof(length) <= data.size());
+        std::memcpy(&length, data.data() + _storedPosition, sizeof(length));
+        _storedPosition += sizeof(length);
+
+        if (length == ResultSetRows::NullValue)
+        {
+            _currRow[i].SetStructuredValue(nullptr, 0);
+            continue;
+        }
+
+        ASSERT(_storedPosition + length < data.size());
+        _currRow[i].SetStructuredValue(data.data() + _storedPosition, length);
+        _storedPosition += length + 1;
+    }
+
+    return true;
+}
+
+uint64 ResultSet::SerializeRows(std::string& buffer)
+{
+    uint64 rows{};
+
+    do
+    {
+        for (uint32 i = 0; i < _fieldCount; i++)
+        {
+            Field const& field = _currRow[i];
+            uint32 length = field.IsNull() ? ResultSetRows::NullValue : field.data.length;
+            buffer.append(reinterpret_cast<char const*>(&length), sizeof(length));
+
+            if (field.IsNull())
+                continue;
+
+            buffer.append(field.data.value, field.data.length);
+            buffer.push_back('\0');
+        }
+
+        ++rows;
+    } while (NextRow());
+
+    return rows;
+}
+
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
 }
 
 void ResultSet::CleanUp()
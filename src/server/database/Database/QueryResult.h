@@ -20,6 +20,8 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Field.h"
+#include <memory>
+#include <string_view>
 #include <unordered_map>
 
 template<typename T>
@@ -43,16 +45,33 @@ private:
     pointer _ptr;
 };
 
+/// Rows of an ad hoc query kept outside of MySQL, e.g. in the world data snapshot.
+/// Every value is stored as uint32 length (ResultSetRows::NullValue for NULL) followed by the value and a terminating zero.
+struct ResultSetRows
+{
+    static constexpr uint32 NullValue = 0xFFFFFFFF;
+
+    std::vector<QueryResultFieldMetadata> FieldMetadata;
+    std::string_view Data;
+    uint64 RowCount{};
+    std::shared_ptr<void const> Owner;              // keeps the memory of Data alive
+};
+
 class WH_DATABASE_API ResultSet
 {
 public:
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    explicit ResultSet(ResultSetRows rows);
     ~ResultSet();
 
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
+    [[nodiscard]] std::vector<QueryResultFieldMetadata> const& GetFieldMetadata() const { return _fieldMetadata; }
+
+    /// Appends the current and all remaining rows to buffer in the ResultSetRows format, returns the number of rows written
+    uint64 SerializeRows(std::string& buffer);
 
     [[nodiscard]] auto* Fetch() const { return _currRow.get(); }
     Field const& operator[](std::size_t index) const;
@@ -86,9 +105,14 @@ private:
     void CleanUp();
     void AssertRows(std::size_t sizeRows) const;
 
+    bool NextStoredRow();
+
     MySQLResult* _result;
     MySQLField* _fields;
 
+    ResultSetRows _storedRows;
+    std::size_t _storedPosition{};
+
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
@@ -102,6 +126,7 @@ public:
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
+    [[nodiscard]] std::vector<QueryResultFieldMetadata> const& GetFieldMetadata() const { return _fieldMetadata; }
 
     [[nodiscard]] Field* Fetch() const;
     Field const& operator[](std::size_t index) const;
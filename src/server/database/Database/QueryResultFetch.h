@@ -0,0 +1,239 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _QUERYRESULTFETCH_H
+#define _QUERYRESULTFETCH_H
+
+#include "Errors.h"
+#include "Field.h"
+#include "QueryResult.h"
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Warhead::Impl::QueryResultFetchImpl
+{
+    template<typename T>
+    T FromText(char const* value, uint32 length)
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+            return { value, length };
+        else if constexpr (std::is_same_v<T, Binary>)
+            return { value, value + length };
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            // strtod needs a terminated string, values of a row are not always terminated
+            char buffer[64];
+            if (length >= sizeof(buffer))
+                return T{};
+
+            std::memcpy(buffer, value, length);
+            buffer[length] = '\0';
+
+            char* end = nullptr;
+            T result{};
+            if constexpr (std::is_same_v<T, float>)
+                result = std::strtof(buffer, &end);
+            else
+                result = std::strtod(buffer, &end);
+
+            return end == buffer + length ? result : T{};
+        }
+        else
+        {
+            using Parsed = std::conditional_t<std::is_same_v<T, bool>, uint8, T>;
+
+            // the whole value must be a number, "12abc" or "1.5" are not
+            auto parsed = [value, length](auto& result)
+            {
+                auto [ptr, ec] = std::from_chars(value, value + length, result);
+                return ec == std::errc() && ptr == value + length;
+            };
+
+            Parsed result{};
+            if (parsed(result))
+                return static_cast<T>(result);
+
+            // Negative values in unsigned fields are accepted the same way Field::Get does
+            if constexpr (std::is_unsigned_v<Parsed>)
+            {
+                std::make_signed_t<Parsed> signedResult{};
+                if (parsed(signedResult))
+                    return static_cast<T>(signedResult);
+            }
+
+            return T{};
+        }
+    }
+
+    template<typename T, typename Stored>
+    T FromRaw(char const* value, uint32 /*length*/)
+    {
+        Stored stored;
+        std::memcpy(&stored, value, sizeof(Stored));
+        return static_cast<T>(stored);
+    }
+
+    template<typename T, typename Signed, typename Unsigned>
+    using RawInt = std::conditional_t<std::is_signed_v<T>, Signed, Unsigned>;
+
+    template<typename Member>
+    struct MemberOf;
+
+    template<typename Class, typename Value>
+    struct MemberOf<Value Class::*>
+    {
+        using ClassType = Class;
+        using ValueType = Value;
+    };
+
+    template<auto Member>
+    using MemberValue = typename MemberOf<decltype(Member)>::ValueType;
+
+    template<typename Result>
+    constexpr bool IsRawResult = std::is_same_v<Result, PreparedResultSet>;
+}
+
+/// Converts the values of one result column to T. The conversion is picked once from the column type
+/// and the protocol of the result, decoding a value doesn't look at the field metadata again.
+/// NULL and values not representable in T decode as T{}.
+template<typename T>
+class ColumnDecoder
+{
+    static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, std::string> || std::is_same_v<T, Binary>, "Unsupported type for ColumnDecoder");
+
+public:
+    ColumnDecoder([[maybe_unused]] QueryResultFieldMetadata const& meta, [[maybe_unused]] bool raw)
+    {
+        using namespace Warhead::Impl::QueryResultFetchImpl;
+
+        _decode = &FromText<T>;
+
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            if (!raw)
+                return;
+
+            switch (meta.Type)
+            {
+                case DatabaseFieldTypes::Int8:
+                    _decode = &FromRaw<T, RawInt<T, int8, uint8>>;
+                    break;
+                case DatabaseFieldTypes::Int16:
+                    _decode = &FromRaw<T, RawInt<T, int16, uint16>>;
+                    break;
+                case DatabaseFieldTypes::Int32:
+                    _decode = &FromRaw<T, RawInt<T, int32, uint32>>;
+                    break;
+                case DatabaseFieldTypes::Int64:
+                    _decode = &FromRaw<T, RawInt<T, int64, uint64>>;
+                    break;
+                case DatabaseFieldTypes::Float:
+                    _decode = &FromRaw<T, float>;
+                    break;
+                case DatabaseFieldTypes::Double:
+                    _decode = &FromRaw<T, double>;
+                    break;
+                default: // Decimal and strings are sent as text by the binary protocol too
+                    break;
+            }
+        }
+    }
+
+    T operator()(Field const& field) const
+    {
+        if (field.IsNull())
+            return T{};
+
+        return _decode(field.data.value, field.data.length);
+    }
+
+private:
+    T(*_decode)(char const* value, uint32 length);
+};
+
+/// Decodes the current and all remaining rows of result, column i into the i-th of Members.
+/// Usage: FetchRows<&CreatureRow::Guid, &CreatureRow::Id, ...>(*result)
+template<auto... Members, typename Result>
+auto FetchRows(Result& result)
+{
+    using namespace Warhead::Impl::QueryResultFetchImpl;
+    using Row = typename MemberOf<std::tuple_element_t<0, std::tuple<decltype(Members)...>>>::ClassType;
+
+    static_assert(sizeof...(Members) > 0);
+    static_assert((std::is_same_v<typename MemberOf<decltype(Members)>::ClassType, Row> && ...), "All members must belong to the same row type");
+
+    std::vector<QueryResultFieldMetadata> const& metadata = result.GetFieldMetadata();
+    ASSERT(metadata.size() == sizeof...(Members), "> FetchRows: result has {} fields, the row mapping {}", metadata.size(), sizeof...(Members));
+
+    auto decoders = [&]<std::size_t... Indexes>(std::index_sequence<Indexes...>)
+    {
+        return std::make_tuple(ColumnDecoder<MemberValue<Members>>(metadata[Indexes], IsRawResult<Result>)...);
+    }(std::index_sequence_for<decltype(Members)...>{});
+
+    std::vector<Row> rows;
+    rows.reserve(result.GetRowCount());
+
+    do
+    {
+        Field const* fields = result.Fetch();
+        Row& row = rows.emplace_back();
+
+        [&]<std::size_t... Indexes>(std::index_sequence<Indexes...>)
+        {
+            ((row.*Members = std::get<Indexes>(decoders)(fields[Indexes])), ...);
+        }(std::index_sequence_for<decltype(Members)...>{});
+    } while (result.NextRow());
+
+    return rows;
+}
+
+/// Decodes the current and all remaining rows of result into one vector per column
+template<typename... Ts, typename Result>
+std::tuple<std::vector<Ts>...> FetchColumns(Result& result)
+{
+    using namespace Warhead::Impl::QueryResultFetchImpl;
+
+    std::vector<QueryResultFieldMetadata> const& metadata = result.GetFieldMetadata();
+    ASSERT(metadata.size() == sizeof...(Ts), "> FetchColumns: result has {} fields, requested {}", metadata.size(), sizeof...(Ts));
+
+    std::tuple<std::vector<Ts>...> columns;
+    std::tuple<ColumnDecoder<Ts>...> decoders = [&]<std::size_t... Indexes>(std::index_sequence<Indexes...>)
+    {
+        (std::get<Indexes>(columns).reserve(result.GetRowCount()), ...);
+        return std::make_tuple(ColumnDecoder<Ts>(metadata[Indexes], IsRawResult<Result>)...);
+    }(std::index_sequence_for<Ts...>{});
+
+    do
+    {
+        Field const* fields = result.Fetch();
+
+        [&]<std::size_t... Indexes>(std::index_sequence<Indexes...>)
+        {
+            (std::get<Indexes>(columns).emplace_back(std::get<Indexes>(decoders)(fields[Indexes])), ...);
+        }(std::index_sequence_for<Ts...>{});
+    } while (result.NextRow());
+
+    return columns;
+}
+
+#endif
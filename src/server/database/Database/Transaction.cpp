@@ -49,6 +49,37 @@ void Transaction::Append(PreparedStatement stmt)
     _queries.emplace_back(data);
 }
 
+std::size_t Transaction::GetDataSize(std::size_t firstQuery /*= 0*/) const
+{
+    std::size_t size{};
+
+    for (std::size_t i = firstQuery; i < _queries.size(); ++i)
+    {
+        if (auto sql = std::get_if<std::string>(&_queries[i].element))
+        {
+            size += sql->size();
+            continue;
+        }
+
+        for (auto const& parameter : std::get<PreparedStatement>(_queries[i].element)->GetParameters())
+        {
+            size += std::visit([](auto const& value) -> std::size_t
+            {
+                using T = std::decay_t<decltype(value)>;
+
+                if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<uint8>>)
+                    return value.size();
+                else if constexpr (std::is_same_v<T, std::nullptr_t>)
+                    return 0;
+                else
+                    return sizeof(T);
+            }, parameter.data);
+        }
+    }
+
+    return size;
+}
+
 void Transaction::Cleanup()
 {
     // This might be called by explicit calls to Clean up or by the auto-destructor
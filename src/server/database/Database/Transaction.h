@@ -56,6 +56,9 @@ public:
     void Append(PreparedStatement stmt);
 
     [[nodiscard]] std::size_t GetSize() const { return _queries.size(); }
+
+    /// Bytes of raw queries and statement parameters, starting at query firstQuery
+    [[nodiscard]] std::size_t GetDataSize(std::size_t firstQuery = 0) const;
     auto GetQueries() { return &_queries; }
 
     void Cleanup();
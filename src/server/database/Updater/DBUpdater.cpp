@@ -27,12 +27,97 @@
 #include "MySQLConnection.h"
 #include "ProgressBar.h"
 #include "StartProcess.h"
+#include "ThreadPool.h"
 #include "UpdateFetcher.h"
+#include "Util.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <numeric>
+#include <sstream>
 
 constexpr auto SQL_BASE_DIR = "/data/sql/base/";
 
+namespace
+{
+    bool IsSpace(char c)
+    {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    std::string_view TrimSpaces(std::string_view str)
+    {
+        while (!str.empty() && IsSpace(str.front()))
+            str.remove_prefix(1);
+
+        while (!str.empty() && IsSpace(str.back()))
+            str.remove_suffix(1);
+
+        return str;
+    }
+
+    std::string ReadSQLFile(std::filesystem::path const& path)
+    {
+        std::ifstream in(path);
+        if (!in.is_open())
+        {
+            LOG_CRIT("db.update", "Failed to open the sql file \'{}\' for reading!", path.generic_string());
+            throw UpdateException("update failed");
+        }
+
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    // Splits the column list of a CREATE TABLE statement, body starts after its opening parenthesis, at the commas
+    // outside of parentheses and quotes. end is set to the position of the closing parenthesis, npos if there is none.
+    std::vector<std::string_view> SplitDefinitions(std::string_view body, std::size_t& end)
+    {
+        std::vector<std::string_view> definitions;
+        std::size_t start{};
+        uint32 depth{};
+        char quote{};
+
+        end = std::string_view::npos;
+
+        for (std::size_t i = 0; i < body.size() && end == std::string_view::npos; ++i)
+        {
+            char const c = body[i];
+
+            if (quote)
+            {
+                if (c == '\\' && quote != '`')
+                    ++i;
+                else if (c == quote)
+                    quote = 0;
+            }
+            else if (c == '\'' || c == '"' || c == '`')
+                quote = c;
+            else if (c == '(')
+                ++depth;
+            else if (c == ')' && !depth)
+                end = i;
+            else if (c == ')')
+                --depth;
+            else if (c == ',' && !depth)
+            {
+                definitions.emplace_back(TrimSpaces(body.substr(start, i - start)));
+                start = i + 1;
+            }
+        }
+
+        if (end == std::string_view::npos)
+            return {};
+
+        definitions.emplace_back(TrimSpaces(body.substr(start, end - start)));
+        return definitions;
+    }
+}
+
 std::string DBUpdaterUtil::GetCorrectedMySQLExecutable()
 {
     if (!corrected_path().empty())
@@ -63,6 +148,155 @@ bool DBUpdaterUtil::CheckExecutable()
     return true;
 }
 
+std::vector<std::string> DBUpdaterUtil::SplitStatements(std::string_view sql)
+{
+    std::vector<std::string> statements;
+    std::string statement;
+    std::string delimiter{ ";" };
+    bool hasContent{};
+    std::size_t i{};
+
+    auto FinishStatement = [&]()
+    {
+        if (hasContent)
+            statements.emplace_back(TrimSpaces(statement));
+
+        statement.clear();
+        hasContent = false;
+    };
+
+    auto FindLineEnd = [&sql](std::size_t pos)
+    {
+        std::size_t const end = sql.find('\n', pos);
+        return end == std::string_view::npos ? sql.size() : end;
+    };
+
+    while (i < sql.size())
+    {
+        char const c = sql[i];
+
+        // DELIMITER is a command of the mysql client, the server doesn't know it
+        if (!hasContent && StringStartsWithI(sql.substr(i), "DELIMITER") && i + 9 < sql.size() && IsSpace(sql[i + 9]))
+        {
+            std::size_t const end = FindLineEnd(i);
+            std::string_view const newDelimiter = TrimSpaces(sql.substr(i + 9, end - i - 9));
+            if (!newDelimiter.empty())
+                delimiter = newDelimiter;
+
+            statement.clear();
+            i = end;
+            continue;
+        }
+
+        // Quoted strings and names, a delimiter inside doesn't end the statement
+        if (c == '\'' || c == '"' || c == '`')
+        {
+            std::size_t end = i + 1;
+            while (end < sql.size() && sql[end] != c)
+                end += (sql[end] == '\\' && c != '`') ? 2 : 1;
+
+            end = std::min(end + 1, sql.size());
+            statement.append(sql.substr(i, end - i));
+            hasContent = true;
+            i = end;
+            continue;
+        }
+
+        // Line comments
+        if (c == '#' || (c == '-' && i + 1 < sql.size() && sql[i + 1] == '-' && (i + 2 == sql.size() || IsSpace(sql[i + 2]))))
+        {
+            i = FindLineEnd(i);
+            continue;
+        }
+
+        // Block comments, /*! and /*+ are executed by the server
+        if (c == '/' && i + 1 < sql.size() && sql[i + 1] == '*')
+        {
+            std::size_t end = sql.find("*/", i + 2);
+            end = end == std::string_view::npos ? sql.size() : end + 2;
+
+            if (i + 2 < sql.size() && (sql[i + 2] == '!' || sql[i + 2] == '+'))
+            {
+                statement.append(sql.substr(i, end - i));
+                hasContent = true;
+            }
+            else
+                statement += ' ';
+
+            i = end;
+            continue;
+        }
+
+        if (StringStartsWith(sql.substr(i), delimiter))
+        {
+            FinishStatement();
+            i += delimiter.size();
+            continue;
+        }
+
+        if (!IsSpace(c))
+            hasContent = true;
+
+        statement += c;
+        ++i;
+    }
+
+    FinishStatement();
+    return statements;
+}
+
+void DBUpdaterUtil::DeferIndexes(std::vector<std::string>& statements)
+{
+    std::vector<std::string> alterStatements;
+
+    for (auto& statement : statements)
+    {
+        if (!StringStartsWithI(statement, "CREATE TABLE"))
+            continue;
+
+        std::size_t const open = statement.find('(');
+        if (open == std::string::npos)
+            continue;
+
+        // The table options after the column list may hold parentheses too, e.g. in COMMENT
+        std::size_t length{};
+        std::vector<std::string_view> const definitions = SplitDefinitions(std::string_view(statement).substr(open + 1), length);
+        if (length == std::string_view::npos)
+            continue;
+
+        std::size_t const close = open + 1 + length;
+
+        std::string_view tableName = TrimSpaces(std::string_view(statement).substr(12, open - 12));
+        if (StringStartsWithI(tableName, "IF NOT EXISTS"))
+            tableName = TrimSpaces(tableName.substr(13));
+
+        std::vector<std::string_view> columns;
+        std::vector<std::string_view> indexes;
+
+        for (std::string_view definition : definitions)
+        {
+            if (definition.empty())
+                continue;
+
+            if (StringStartsWithI(definition, "KEY ") || StringStartsWithI(definition, "INDEX ") || StringStartsWithI(definition, "UNIQUE ") ||
+                StringStartsWithI(definition, "FULLTEXT ") || StringStartsWithI(definition, "CONSTRAINT ") || StringStartsWithI(definition, "FOREIGN KEY"))
+                indexes.emplace_back(definition);
+            else
+                columns.emplace_back(definition);
+        }
+
+        if (indexes.empty() || columns.empty())
+            continue;
+
+        std::string alter = Warhead::StringFormat("ALTER TABLE {} ADD {}", tableName, fmt::join(indexes, ", ADD "));
+        statement = Warhead::StringFormat("{}\n  {}\n{}", statement.substr(0, open + 1), fmt::join(columns, ",\n  "), statement.substr(close));
+        alterStatements.emplace_back(std::move(alter));
+    }
+
+    for (auto& alter : alterStatements)
+        statements.emplace_back(std::move(alter));
+}
+
 std::string& DBUpdaterUtil::corrected_path()
 {
     static std::string path;
@@ -88,6 +322,18 @@ std::string DBUpdater::GetBaseFilesDirectory(DatabaseWorkerPool const& pool)
     return BuiltInConfig::GetSourceDirectory() + SQL_BASE_DIR + folderName;
 }
 
+DBUpdater::Path DBUpdater::GetHashCacheFile(DatabaseWorkerPool& pool)
+{
+    // Next to the client config of the pool, see DatabaseWorkerPool::MakeExtraFile
+    Path path(std::string{ pool.GetPathToExtraFile() });
+    return path.replace_filename(std::string{ pool.GetPoolName() } + "UpdateHashes.cache");
+}
+
+bool DBUpdater::IsUsingMySQLClient()
+{
+    return sConfigMgr->GetOption<bool>("Updates.UseMySQLClient", true);
+}
+
 bool DBUpdater::IsEnabled(DatabaseWorkerPool& pool, uint32 updateMask)
 {
     // This way silences warnings under msvc
@@ -149,9 +395,9 @@ bool DBUpdater::Create(DatabaseWorkerPool& pool)
     return true;
 }
 
-bool DBUpdater::Update(DatabaseWorkerPool& pool, std::string_view modulesList /*= {}*/)
+bool DBUpdater::Update(DatabaseWorkerPool& pool, std::string_view modulesList /*= {}*/, bool showProgress /*= true*/)
 {
-    if (!DBUpdaterUtil::CheckExecutable())
+    if (IsUsingMySQLClient() && !DBUpdaterUtil::CheckExecutable())
         return false;
 
     LOG_INFO("db.update", "Updating {} database...", DBUpdater::GetTableName(pool));
@@ -197,6 +443,11 @@ bool DBUpdater::Update(DatabaseWorkerPool& pool, std::string_view modulesList /*
     [&pool](Path const& file) { DBUpdater::ApplyFile(pool, file); },
     [&pool](std::string_view query) -> QueryResult { return DBUpdater::Retrieve(pool, query); }, DBUpdater::GetDBModuleName(pool), modulesList);
 
+    updateFetcher.SetShowProgress(showProgress);
+
+    if (sConfigMgr->GetOption<bool>("Updates.HashCache", true))
+        updateFetcher.SetHashCacheFile(GetHashCacheFile(pool));
+
     UpdateResult result;
     try
     {
@@ -221,7 +472,7 @@ bool DBUpdater::Update(DatabaseWorkerPool& pool, std::string_view modulesList /*
 
 bool DBUpdater::Update(DatabaseWorkerPool& pool, std::vector<std::string> const* setDirectories)
 {
-    if (!DBUpdaterUtil::CheckExecutable())
+    if (IsUsingMySQLClient() && !DBUpdaterUtil::CheckExecutable())
         return false;
 
     Path const sourceDirectory(BuiltInConfig::GetSourceDirectory());
@@ -271,7 +522,7 @@ bool DBUpdater::Update(DatabaseWorkerPool& pool, std::vector<std::string> const*
     return true;
 }
 
-bool DBUpdater::Populate(DatabaseWorkerPool& pool)
+bool DBUpdater::Populate(DatabaseWorkerPool& pool, bool showProgress /*= true*/, uint32 importThreads /*= 0*/)
 {
     {
         QueryResult const result = Retrieve(pool, "SHOW TABLES");
@@ -279,7 +530,7 @@ bool DBUpdater::Populate(DatabaseWorkerPool& pool)
             return true;
     }
 
-    if (!DBUpdaterUtil::CheckExecutable())
+    if (IsUsingMySQLClient() && !DBUpdaterUtil::CheckExecutable())
         return false;
 
     LOG_INFO("db.update", "Database {} is empty, auto populating it...", DBUpdater::GetTableName(pool));
@@ -299,42 +550,61 @@ bool DBUpdater::Populate(DatabaseWorkerPool& pool)
         return false;
     }
 
-    std::size_t filesCount{ 0 };
+    std::vector<Path> files;
 
     for (auto const& dirEntry : std::filesystem::directory_iterator(dirPath))
     {
         if (dirEntry.path().extension() == ".sql")
-            filesCount++;
+            files.emplace_back(dirEntry.path());
     }
 
-    if (!filesCount)
+    if (files.empty())
     {
         LOG_ERROR("db.update", ">> In directory \"{}\" not exist '*.sql' files", dirPath.generic_string());
         return false;
     }
 
-    ProgressBar progress("", filesCount);
-
-    for (auto const& dirEntry : std::filesystem::directory_iterator(dirPath))
+    if (importThreads && !IsUsingMySQLClient())
     {
-        auto const& path = dirEntry.path();
-        if (path.extension() != ".sql")
-            continue;
+        if (!ImportFiles(pool, files, importThreads))
+            return false;
+
+        LOG_INFO("db.update", ">> Done!");
+        LOG_INFO("db.update", "");
+        return true;
+    }
+
+    // Several databases populated at once would draw over each other's progress bar
+    std::unique_ptr<ProgressBar> progress;
+    if (showProgress)
+        progress = std::make_unique<ProgressBar>("", files.size());
 
+    for (auto const& path : files)
+    {
         try
         {
-            progress.UpdatePostfixText(path.filename().generic_string());
-            progress.Update();
+            if (progress)
+            {
+                progress->UpdatePostfixText(path.filename().generic_string());
+                progress->Update();
+            }
+            else
+                LOG_INFO("db.update", "> {}: {}", DBUpdater::GetTableName(pool), path.filename().generic_string());
+
             ApplyFile(pool, path);
         }
         catch (UpdateException&)
         {
-            progress.Stop();
+            if (progress)
+                progress->Stop();
+
             return false;
         }
     }
 
-    progress.Stop();
+    if (progress)
+        progress->Stop();
+
     LOG_INFO("db.update", ">> Done!");
     LOG_INFO("db.update", "");
     return true;
@@ -352,10 +622,102 @@ void DBUpdater::Apply(DatabaseWorkerPool& pool, std::string_view query)
 
 void DBUpdater::ApplyFile(DatabaseWorkerPool& pool, Path const& path)
 {
+    if (!IsUsingMySQLClient())
+    {
+        ExecuteFile(pool, path);
+        return;
+    }
+
     DBUpdater::ApplyFile(pool, pool.GetConnectionInfo()->Host, pool.GetConnectionInfo()->User, pool.GetConnectionInfo()->Password,
         pool.GetConnectionInfo()->PortOrSocket, pool.GetConnectionInfo()->Database, pool.GetConnectionInfo()->SSL, path);
 }
 
+void DBUpdater::ExecuteFile(DatabaseWorkerPool& pool, Path const& path)
+{
+    if (!pool.DirectExecuteScript(DBUpdaterUtil::SplitStatements(ReadSQLFile(path))))
+    {
+        LOG_CRIT("db.update", "Applying of file \'{}\' to database \'{}\' failed!" \
+            " If you are a user, please pull the latest revision from the repository. "
+            "Also make sure you have not applied any of the databases with your sql client. "
+            "You cannot use auto-update system and import sql files from WarheadCore repository with your sql client. "
+            "If you are a developer, please fix your sql query.",
+            path.generic_string(), pool.GetConnectionInfo()->Database);
+
+        throw UpdateException("update failed");
+    }
+}
+
+bool DBUpdater::ImportFiles(DatabaseWorkerPool& pool, std::vector<Path> const& files, uint32 threads)
+{
+    threads = std::min<uint32>(threads, files.size());
+
+    LOG_INFO("db.update", "> Importing {} files with {} threads...", files.size(), threads);
+
+    std::vector<Milliseconds> timings(files.size());
+    std::atomic<bool> failed{ false };
+    auto const startTime = std::chrono::steady_clock::now();
+
+    // Every base file holds its own table, each import runs on its own connection, see DirectExecuteScript
+    Warhead::ThreadPool threadPool(threads);
+
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+        threadPool.PostWork([&pool, &files, &timings, &failed, i]()
+        {
+            if (failed)
+                return;
+
+            try
+            {
+                timings[i] = ImportFile(pool, files[i]);
+            }
+            catch (UpdateException const&)
+            {
+                failed = true;
+            }
+        });
+    }
+
+    threadPool.Wait();
+
+    if (failed)
+        return false;
+
+    // Slowest tables first
+    std::vector<std::size_t> order(files.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&timings](std::size_t left, std::size_t right) { return timings[left] > timings[right]; });
+
+    for (std::size_t i : order)
+        LOG_INFO("db.update", ">> {:<50} {} ms", files[i].stem().generic_string(), timings[i].count());
+
+    LOG_INFO("db.update", ">> Imported {} tables in {} ms ({} ms importing one by one)", files.size(),
+        std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - startTime).count(),
+        std::accumulate(timings.begin(), timings.end(), 0ms).count());
+
+    return true;
+}
+
+Milliseconds DBUpdater::ImportFile(DatabaseWorkerPool& pool, Path const& path)
+{
+    auto const startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::string> statements = DBUpdaterUtil::SplitStatements(ReadSQLFile(path));
+    DBUpdaterUtil::DeferIndexes(statements);
+
+    // The base files are consistent, checking every row only slows the import down. The script connection
+    // is closed after the file whether it failed or not, so the checks never stay off for other callers.
+    statements.insert(statements.begin(), { "SET SESSION unique_checks = 0", "SET SESSION foreign_key_checks = 0" });
+
+    if (!pool.DirectExecuteScript(statements))
+    {
+        LOG_CRIT("db.update", "Importing of file \'{}\' to database \'{}\' failed!", path.generic_string(), pool.GetConnectionInfo()->Database);
+        throw UpdateException("import failed");
+    }
+
+    return std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - startTime);
+}
+
 void DBUpdater::ApplyFile(DatabaseWorkerPool& pool, std::string_view host, std::string_view user, std::string_view password,
     std::string_view port_or_socket, std::string_view database, std::string_view ssl, Path const& path)
 {
@@ -22,6 +22,7 @@
 #include "Define.h"
 #include <filesystem>
 #include <string>
+#include <vector>
 
 class DatabaseWorkerPool;
 
@@ -44,6 +45,14 @@ public:
     static std::string GetCorrectedMySQLExecutable();
     static bool CheckExecutable();
 
+    // Splits a sql file into its statements the way the mysql client does,
+    // including DELIMITER commands. Comments are removed except /*! and /*+ ones.
+    static std::vector<std::string> SplitStatements(std::string_view sql);
+
+    // Moves secondary indexes and foreign keys out of the CREATE TABLE statements into ALTER TABLE
+    // statements at the end. InnoDB builds an index from the loaded rows a lot faster than row by row.
+    static void DeferIndexes(std::vector<std::string>& statements);
+
 private:
     static std::string& corrected_path();
 };
@@ -58,9 +67,12 @@ public:
     static std::string GetBaseFilesDirectory(DatabaseWorkerPool const& pool);
     static bool IsEnabled(DatabaseWorkerPool& pool, uint32 updateMask);
     static bool Create(DatabaseWorkerPool& pool);
-    static bool Update(DatabaseWorkerPool& pool, std::string_view modulesList = {});
+    static bool Update(DatabaseWorkerPool& pool, std::string_view modulesList = {}, bool showProgress = true);
     static bool Update(DatabaseWorkerPool& pool, std::vector<std::string> const* setDirectories);
-    static bool Populate(DatabaseWorkerPool& pool);
+    static bool Populate(DatabaseWorkerPool& pool, bool showProgress = true, uint32 importThreads = 0);
+
+    // Files are sent over a pool connection unless Updates.UseMySQLClient is set
+    static bool IsUsingMySQLClient();
 
     // module
     static std::string GetDBModuleName(DatabaseWorkerPool const& pool);
@@ -69,6 +81,12 @@ private:
     static QueryResult Retrieve(DatabaseWorkerPool& pool, std::string_view query);
     static void Apply(DatabaseWorkerPool& pool, std::string_view query);
     static void ApplyFile(DatabaseWorkerPool& pool, Path const& path);
+    static void ExecuteFile(DatabaseWorkerPool& pool, Path const& path);
+
+    // Bulk import of base files into an empty database, see Populate
+    static bool ImportFiles(DatabaseWorkerPool& pool, std::vector<Path> const& files, uint32 threads);
+    static Milliseconds ImportFile(DatabaseWorkerPool& pool, Path const& path);
+    static Path GetHashCacheFile(DatabaseWorkerPool& pool);
     static void ApplyFile(DatabaseWorkerPool& pool, std::string_view host, std::string_view user,
         std::string_view password, std::string_view port_or_socket, std::string_view database, std::string_view ssl, Path const& path);
 };
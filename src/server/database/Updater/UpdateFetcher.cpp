@@ -26,8 +26,12 @@
 #include "Log.h"
 #include "ProgressBar.h"
 #include "StopWatch.h"
+#include "StringConvert.h"
+#include "ThreadPool.h"
 #include "Tokenize.h"
 #include "Util.h"
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -243,9 +247,118 @@ std::string UpdateFetcher::ReadSQLUpdate(Path const& file)
     return update;
 }
 
+UpdateFetcher::FileHashStorage UpdateFetcher::HashFiles(std::vector<Path> const& files) const
+{
+    struct FileHash
+    {
+        uintmax_t Size{};
+        int64 Time{};
+        std::string Hash;
+    };
+
+    // name size time hash, one file per line
+    std::unordered_map<std::string, FileHash> cache;
+
+    if (!_hashCacheFile.empty())
+    {
+        std::ifstream in(_hashCacheFile);
+        std::string line;
+
+        while (std::getline(in, line))
+        {
+            std::vector<std::string_view> const tokens = Warhead::Tokenize(line, '\t', false);
+            if (tokens.size() != 4)
+                continue;
+
+            Optional<uint64> size = Warhead::StringTo<uint64>(tokens[1]);
+            Optional<int64> time = Warhead::StringTo<int64>(tokens[2]);
+            if (!size || !time)
+                continue;
+
+            cache[std::string(tokens[0])] = { *size, *time, std::string(tokens[3]) };
+        }
+    }
+
+    std::vector<FileHash> hashes(files.size());
+    std::vector<std::size_t> changedFiles;
+
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+        std::error_code error;
+        hashes[i].Size = fs::file_size(files[i], error);
+        hashes[i].Time = static_cast<int64>(fs::last_write_time(files[i], error).time_since_epoch().count());
+
+        auto const itr = cache.find(files[i].filename().string());
+        if (!error && itr != cache.end() && itr->second.Size == hashes[i].Size && itr->second.Time == hashes[i].Time)
+            hashes[i].Hash = itr->second.Hash;
+        else
+            changedFiles.emplace_back(i);
+    }
+
+    if (!changedFiles.empty())
+    {
+        std::size_t const threads = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, changedFiles.size());
+        std::atomic<bool> failed{ false };
+
+        Warhead::ThreadPool pool(threads);
+
+        for (std::size_t index : changedFiles)
+        {
+            pool.PostWork([&files, &hashes, &failed, index]()
+            {
+                try
+                {
+                    hashes[index].Hash = ByteArrayToHexStr(Warhead::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(files[index])));
+                }
+                catch (UpdateException const&)
+                {
+                    failed = true;
+                }
+            });
+        }
+
+        pool.Wait();
+
+        if (failed)
+            throw UpdateException("Opening the sql update failed!");
+
+        LOG_DEBUG("db.update", "Hashed {} of {} sql files with {} threads", changedFiles.size(), files.size(), threads);
+    }
+
+    FileHashStorage storage;
+
+    for (std::size_t i = 0; i < files.size(); ++i)
+        storage.emplace(files[i].filename().string(), hashes[i].Hash);
+
+    // Rewritten with the current files only, so removed ones don't stay forever
+    if (!_hashCacheFile.empty() && !changedFiles.empty())
+    {
+        std::ofstream out(_hashCacheFile, std::ios::trunc);
+        if (!out.is_open())
+        {
+            LOG_WARN("db.update", "Failed to write the update hash cache \"{}\"", _hashCacheFile.generic_string());
+            return storage;
+        }
+
+        for (std::size_t i = 0; i < files.size(); ++i)
+            out << files[i].filename().string() << '\t' << hashes[i].Size << '\t' << hashes[i].Time << '\t' << hashes[i].Hash << '\n';
+    }
+
+    return storage;
+}
+
 UpdateResult UpdateFetcher::Update() const
 {
     auto const cleanDeadReferencesMaxCount = sConfigMgr->GetOption<int32>("Updates.CleanDeadRefMaxCount", 3);
+    bool const redundancyChecks = sConfigMgr->GetOption<bool>("Updates.Redundancy", true);
+    bool const allowRehash = sConfigMgr->GetOption<bool>("Updates.AllowRehash", true);
+    bool const archivedRedundancy = sConfigMgr->GetOption<bool>("Updates.ArchivedRedundancy", false);
+
+    // Applied updates which are neither rehashed nor reapplied, they don't need a hash
+    auto SkipRedundancyCheck = [redundancyChecks, archivedRedundancy](AppliedFileEntry const& entry, State const fileState)
+    {
+        return !redundancyChecks || (!archivedRedundancy && (entry.state == ARCHIVED) && (fileState == ARCHIVED));
+    };
 
     LocaleFileStorage const available = GetFileList();
     if (_setDirectories && available.empty())
@@ -270,31 +383,40 @@ UpdateResult UpdateFetcher::Update() const
 
     size_t importedUpdates = 0;
 
-    auto ApplyUpdateFile = [this, &applied, &hashToName, &available, &importedUpdates](Path const& filePath, State const& fileState, ProgressBar const& progress)
+    // Read and hash the files up front, reading them one by one dominates a run without new updates
+    FileHashStorage hashes;
     {
-        bool const redundancyChecks = sConfigMgr->GetOption<bool>("Updates.Redundancy", true);
-        bool const allowRehash = sConfigMgr->GetOption<bool>("Updates.AllowRehash", true);
-        bool const archivedRedundancy = sConfigMgr->GetOption<bool>("Updates.ArchivedRedundancy", false);
+        std::vector<Path> filesToHash;
 
-        auto const& iter = applied.find(filePath.filename().string());
-        if (iter != applied.end())
+        for (auto const& [path, state] : available)
         {
-            // If redundancy is disabled, skip it, because the update is already applied.
-            if (!redundancyChecks)
-            {
-                applied.erase(iter);
-                return;
-            }
+            auto const itr = applied.find(path.filename().string());
+            if (itr == applied.end() || !SkipRedundancyCheck(itr->second, state))
+                filesToHash.emplace_back(path);
+        }
 
-            // If the update is in an archived directory and is marked as archived in our database, skip redundancy checks (archived updates never change).
-            if (!archivedRedundancy && (iter->second.state == ARCHIVED) && (fileState == ARCHIVED))
-            {
-                applied.erase(iter);
-                return;
-            }
+        hashes = HashFiles(filesToHash);
+    }
+
+    auto ApplyUpdateFile = [this, &applied, &hashToName, &available, &importedUpdates, &hashes, &SkipRedundancyCheck, allowRehash](Path const& filePath, State const& fileState, ProgressBar* progress)
+    {
+        auto const& iter = applied.find(filePath.filename().string());
+
+        // If redundancy is disabled, skip it, because the update is already applied.
+        // If the update is in an archived directory and is marked as archived in our database, skip redundancy checks (archived updates never change).
+        if (iter != applied.end() && SkipRedundancyCheck(iter->second, fileState))
+        {
+            applied.erase(iter);
+            return;
         }
 
-        std::string const hash = ByteArrayToHexStr(Warhead::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(filePath)));
+        std::string const& hash = hashes.at(filePath.filename().string());
+
+        auto ClearLine = [progress]()
+        {
+            if (progress)
+                progress->ClearLine();
+        };
 
         UpdateMode mode = MODE_APPLY;
 
@@ -315,14 +437,14 @@ UpdateResult UpdateFetcher::Update() const
                 // Conflict!
                 if (localeIter != available.end())
                 {
-                    progress.ClearLine();
+                    ClearLine();
                     LOG_WARN("db.update", ">> It seems like the update \"{}\" \'{}\' was renamed, but the old file is still there! " \
                              "Treating it as a new file! (It is probably an unmodified copy of the file \"{}\")",
                              filePath.filename().string(), hash.substr(0, 7), localeIter->first.filename().string());
                 }
                 else // It is safe to treat the file as renamed here
                 {
-                    progress.ClearLine();
+                    ClearLine();
                     LOG_INFO("db.update", ">> Renaming update \"{}\" to \"{}\" \'{}\'.",
                              hashIter->second, filePath.filename().string(), hash.substr(0, 7));
 
@@ -331,14 +453,16 @@ UpdateResult UpdateFetcher::Update() const
                     return;
                 }
             }
+            else if (progress)
+                progress->UpdatePostfixText(filePath.filename().string());
             else
-                progress.UpdatePostfixText(filePath.filename().string());
+                LOG_INFO("db.update", "> {}: Applying update \"{}\"...", _dbModuleName, filePath.filename().string());
         }
         // Rehash the update entry if it exists in our database with an empty hash.
         else if (allowRehash && iter->second.hash.empty())
         {
             mode = MODE_REHASH;
-            progress.ClearLine();
+            ClearLine();
             LOG_INFO("db.update", ">> Re-hashing update \"{}\" \'{}\'...", filePath.filename().string(), hash.substr(0, 7));
         }
         else
@@ -346,7 +470,7 @@ UpdateResult UpdateFetcher::Update() const
             // If the hash of the files differs from the one stored in our database, reapply the update (because it changed).
             if (iter->second.hash != hash)
             {
-                progress.ClearLine();
+                ClearLine();
                 LOG_INFO("db.update", ">> Reapplying update \"{}\" \'{}\' -> \'{}\' (it changed)...",
                     filePath.filename().string(), iter->second.hash.substr(0, 7), hash.substr(0, 7));
             }
@@ -381,15 +505,24 @@ UpdateResult UpdateFetcher::Update() const
             ++importedUpdates;
     };
 
-    ProgressBar progress("", available.size());
+    // Databases updated at once would draw over each other's progress bar
+    std::unique_ptr<ProgressBar> progress;
+    if (_showProgress)
+        progress = std::make_unique<ProgressBar>("", available.size());
+
+    auto UpdateProgress = [&progress]()
+    {
+        if (progress)
+            progress->Update();
+    };
 
     // Apply default updates
     for (auto const& [path, state] : available)
     {
         if (state == RELEASED || state == ARCHIVED)
         {
-            ApplyUpdateFile(path, state, progress);
-            progress.Update();
+            ApplyUpdateFile(path, state, progress.get());
+            UpdateProgress();
         }
     }
 
@@ -398,8 +531,8 @@ UpdateResult UpdateFetcher::Update() const
     {
         if (state == CUSTOM)
         {
-            ApplyUpdateFile(path, state, progress);
-            progress.Update();
+            ApplyUpdateFile(path, state, progress.get());
+            UpdateProgress();
         }
     }
 
@@ -408,12 +541,13 @@ UpdateResult UpdateFetcher::Update() const
     {
         if (state == MODULE)
         {
-            ApplyUpdateFile(path, state, progress);
-            progress.Update();
+            ApplyUpdateFile(path, state, progress.get());
+            UpdateProgress();
         }
     }
 
-    progress.Stop();
+    if (progress)
+        progress->Stop();
 
     // Cleanup up orphaned entries (if enabled)
     if (!applied.empty() && !_setDirectories)
@@ -59,6 +59,12 @@ public:
 
     [[nodiscard]] UpdateResult Update() const;
 
+    // Hashes of unchanged files (same size and modification time) are read from this file
+    void SetHashCacheFile(Path const& path) { _hashCacheFile = path; }
+
+    // Progress bars are replaced by log lines if disabled
+    void SetShowProgress(bool show) { _showProgress = show; }
+
 private:
     enum UpdateMode
     {
@@ -132,6 +138,7 @@ private:
     typedef std::unordered_map<std::string, std::string> HashToFileNameStorage;
     typedef std::unordered_map<std::string, AppliedFileEntry> AppliedFileStorage;
     typedef std::vector<UpdateFetcher::DirectoryEntry> DirectoryStorage;
+    typedef std::unordered_map<std::string, std::string> FileHashStorage;
 
     [[nodiscard]] LocaleFileStorage GetFileList() const;
     static void FillFileListRecursively(Path const& path, LocaleFileStorage& storage,
@@ -142,6 +149,9 @@ private:
 
     [[nodiscard]] static std::string ReadSQLUpdate(Path const& file) ;
 
+    // Returns the hashes by file name, files are read and hashed in parallel
+    [[nodiscard]] FileHashStorage HashFiles(std::vector<Path> const& files) const;
+
     [[nodiscard]] Milliseconds Apply(Path const& path) const;
 
     void UpdateEntry(AppliedFileEntry const& entry, Milliseconds speed = 0ms) const;
@@ -159,6 +169,9 @@ private:
     std::string const _dbModuleName;
     std::vector<std::string> const* _setDirectories;
     std::string _modulesList;
+
+    Path _hashCacheFile;
+    bool _showProgress{ true };
 };
 
 #endif // UpdateFetcher_h__
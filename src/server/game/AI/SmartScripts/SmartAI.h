@@ -69,7 +69,7 @@ public:
     void SetFollow(Unit* target, float dist = 0.0f, float angle = 0.0f, uint32 credit = 0, uint32 end = 0, uint32 creditType = 0, bool aliveState = true);
     void StopFollow(bool complete);
 
-    void SetScript9(SmartScriptHolder& e, uint32 entry, Unit* invoker);
+    void SetScript9(SmartScriptEvent& e, uint32 entry, Unit* invoker);
     SmartScript* GetScript() { return &mScript; }
     bool IsEscortInvokerInRange();
 
@@ -268,7 +268,7 @@ public:
     bool QuestReward(Player* player, Quest const* quest, uint32 opt) override;
     void Destroyed(Player* player, uint32 eventId) override;
     void SetData(uint32 id, uint32 value) override;
-    void SetScript9(SmartScriptHolder& e, uint32 entry, Unit* invoker);
+    void SetScript9(SmartScriptEvent& e, uint32 entry, Unit* invoker);
     void OnGameEvent(bool start, uint16 eventId) override;
     void OnStateChanged(uint32 state, Unit* unit) override;
     void EventInform(uint32 eventId) override;
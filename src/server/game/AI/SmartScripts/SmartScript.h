@@ -29,19 +29,19 @@ public:
 
     void OnInitialize(WorldObject* obj, AreaTrigger const* at = nullptr);
     void GetScript();
-    void FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at);
+    void FillScript(SmartAIEventListPtr const& e, WorldObject* obj, AreaTrigger const* at);
 
     void ProcessEventsFor(SMART_EVENT e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    void ProcessEvent(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    bool CheckTimer(SmartScriptHolder const& e) const;
-    static void RecalcTimer(SmartScriptHolder& e, uint32 min, uint32 max);
-    void UpdateTimer(SmartScriptHolder& e, uint32 diff);
-    static void InitTimer(SmartScriptHolder& e);
-    void ProcessAction(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    void ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    void GetTargets(ObjectVector& targets, SmartScriptHolder const& e, Unit* invoker = nullptr) const;
+    void ProcessEvent(SmartScriptEvent& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
+    bool CheckTimer(SmartScriptEvent const& e) const;
+    static void RecalcTimer(SmartScriptEvent& e, uint32 min, uint32 max);
+    void UpdateTimer(SmartScriptEvent& e, uint32 diff);
+    static void InitTimer(SmartScriptEvent& e);
+    void ProcessAction(SmartScriptEvent& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
+    void ProcessTimedAction(SmartScriptEvent& e, uint32 const& min, uint32 const& max, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
+    void GetTargets(ObjectVector& targets, SmartScriptEvent const& e, Unit* invoker = nullptr) const;
     void GetWorldObjectsInDist(ObjectVector& objects, float dist) const;
-    void InstallTemplate(SmartScriptHolder const& e);
+    void InstallTemplate(SmartScriptEvent const& e);
     static SmartScriptHolder CreateSmartEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, uint32 event_param5, uint32 event_param6, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 target_param4, uint32 phaseMask);
     void AddEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, uint32 event_param5, uint32 event_param6, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 target_param4, uint32 phaseMask);
     void SetPathId(uint32 id) { mPathId = id; }
@@ -107,7 +107,7 @@ public:
     void ResetBaseObject();
 
     //TIMED_ACTIONLIST (script type 9 aka script9)
-    void SetScript9(SmartScriptHolder& e, uint32 entry);
+    void SetScript9(SmartScriptEvent& e, uint32 entry);
     Unit* GetLastInvoker(Unit* invoker = nullptr) const;
     ObjectGuid mLastInvoker;
     typedef std::unordered_map<uint32, uint32> CounterMap;
@@ -138,9 +138,15 @@ private:
     void SetPhase(uint32 p);
     bool IsInPhase(uint32 p) const;
 
-    SmartAIEventList mEvents;
-    SmartAIEventList mInstallEvents;
-    SmartAIEventList mTimedActionList;
+    static bool IsTimedEvent(SmartScriptEvent const& e);
+
+    // shared script lists referenced by mEvents and mTimedActionList, kept alive across reloads
+    std::vector<SmartAIEventListPtr> mScripts;
+    SmartAIEventListPtr mTimedActionListScript;
+
+    SmartScriptEventList mEvents;
+    SmartScriptEventList mInstallEvents;
+    SmartScriptEventList mTimedActionList;
     bool isProcessingTimedActionList;
     Creature* me;
     ObjectGuid meOrigGUID;
@@ -152,7 +158,7 @@ private:
 
     std::unordered_map<int32, int32> mStoredDecimals;
     uint32 mPathId;
-    SmartAIEventStoredList mStoredEvents;
+    SmartScriptEventStoredList mStoredEvents;
     std::list<uint32> mRemIDs;
 
     uint32 mTextTimer;
@@ -181,7 +187,7 @@ private:
     {
         if (!mStoredEvents.empty())
         {
-            for (SmartAIEventStoredList::iterator i = mStoredEvents.begin(); i != mStoredEvents.end(); ++i)
+            for (SmartScriptEventStoredList::iterator i = mStoredEvents.begin(); i != mStoredEvents.end(); ++i)
             {
                 if (i->event_id == id)
                 {
@@ -192,21 +198,13 @@ private:
         }
     }
 
-    SmartScriptHolder FindLinkedEvent (uint32 link)
+    SmartScriptEvent const* FindLinkedEvent(uint32 link) const
     {
-        if (!mEvents.empty())
-        {
-            for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
-            {
-                if (i->event_id == link)
-                {
-                    return (*i);
-                }
-            }
-        }
+        for (SmartScriptEvent const& e : mEvents)
+            if (e.event_id == link)
+                return &e;
 
-        SmartScriptHolder s;
-        return s;
+        return nullptr;
     }
 
     GuidUnorderedSet _summonList;
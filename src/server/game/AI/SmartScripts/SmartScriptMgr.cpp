@@ -145,6 +145,9 @@ void SmartAIMgr::LoadSmartAIFromDB()
 
     uint32 count = 0;
 
+    // built here and published as immutable lists once loading is done
+    std::unordered_map<int32, SmartAIEventList> eventMap[SMART_SCRIPT_TYPE_MAX];
+
     do
     {
         auto fields = result->Fetch();
@@ -288,16 +291,19 @@ void SmartAIMgr::LoadSmartAIFromDB()
                 temp.target.type = SMART_TARGET_POSITION;
 
         // creature entry / guid not found in storage, create empty event list for it and increase counters
-        if (mEventMap[source_type].find(temp.entryOrGuid) == mEventMap[source_type].end())
-        {
+        auto [itr, inserted] = eventMap[source_type].try_emplace(temp.entryOrGuid);
+        if (inserted)
             ++count;
-            SmartAIEventList eventList;
-            mEventMap[source_type][temp.entryOrGuid] = eventList;
-        }
+
         // store the new event
-        mEventMap[source_type][temp.entryOrGuid].push_back(temp);
+        itr->second.push_back(temp);
     } while (result->NextRow());
 
+    // scripts already running keep their own reference to the previous lists
+    for (uint8 i = 0; i < SMART_SCRIPT_TYPE_MAX; i++)
+        for (auto& [entryOrGuid, eventList] : eventMap[i])
+            mEventMap[i].emplace(entryOrGuid, std::make_shared<SmartAIEventList const>(std::move(eventList)));
+
     LOG_INFO("server.loading", ">> Loaded {} SmartAI scripts in {}", count, sw);
     LOG_INFO("server.loading", " ");
 }
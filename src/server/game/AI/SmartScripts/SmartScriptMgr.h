@@ -26,6 +26,7 @@
 #include "Spell.h"
 #include "SpellMgr.h"
 #include "Unit.h"
+#include <memory>
 
 typedef uint32 SAIBool;
 
@@ -1882,12 +1883,11 @@ enum SmartFollowType
     FOLLOW_TYPE_ANGULAR                    = 6                   // geese-like formation 135 and 225 degrees behind leader
 };
 
-// one line in DB is one event
+// one line in DB is one event, shared between all instances using the script
 struct SmartScriptHolder
 {
     SmartScriptHolder() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
-        , event_id(0), link(0), event(), action(), target(), timer(0), active(false), runOnce(false)
-        , enableTimed(false) {}
+        , event_id(0), link(0), event(), action(), target() {}
 
     int32 entryOrGuid;
     SmartScriptType source_type;
@@ -1903,11 +1903,50 @@ public:
     uint32 GetEventType() const { return (uint32)event.type; }
     uint32 GetActionType() const { return (uint32)action.type; }
     uint32 GetTargetType() const { return (uint32)target.type; }
+};
+
+// one event of a running script: runtime state plus a view of the shared DB line
+struct SmartScriptEvent
+{
+    explicit SmartScriptEvent(SmartScriptHolder const& holder) : entryOrGuid(holder.entryOrGuid), source_type(holder.source_type)
+        , event_id(holder.event_id), link(holder.link), event(holder.event), action(holder.action), target(holder.target)
+        , timer(0), active(false), runOnce(false), enableTimed(false), _eventType(holder.event.type) {}
+
+    // events created at runtime (AI templates, timed events) own their line
+    explicit SmartScriptEvent(std::shared_ptr<SmartScriptHolder const> holder) : SmartScriptEvent(*holder)
+    {
+        _holder = std::move(holder);
+    }
+
+    // the view must never outlive the line it points to
+    explicit SmartScriptEvent(SmartScriptHolder&&) = delete;
+
+    int32 entryOrGuid;
+    SmartScriptType source_type;
+    uint32 event_id;
+    uint32 link;
+
+    SmartEvent const& event;
+    SmartAction const& action;
+    SmartTarget const& target;
+
+public:
+    uint32 GetScriptType() const { return (uint32)source_type; }
+    uint32 GetEventType() const { return (uint32)_eventType; }
+    uint32 GetActionType() const { return (uint32)action.type; }
+    uint32 GetTargetType() const { return (uint32)target.type; }
+
+    // in SMART_SCRIPT_TYPE_TIMED_ACTIONLIST the event type is decided by the caller
+    void SetEventType(SMART_EVENT type) { _eventType = type; }
 
     uint32 timer;
     bool active;
     bool runOnce;
     bool enableTimed;
+
+private:
+    SMART_EVENT _eventType;
+    std::shared_ptr<SmartScriptHolder const> _holder;
 };
 
 typedef std::unordered_map<uint32, WayPoint*> WPPath;
@@ -1964,10 +2003,14 @@ private:
 
 // all events for a single entry
 typedef std::vector<SmartScriptHolder> SmartAIEventList;
-typedef std::list<SmartScriptHolder> SmartAIEventStoredList;
+typedef std::shared_ptr<SmartAIEventList const> SmartAIEventListPtr;
 
 // all events for all entries / guids
-typedef std::unordered_map<int32, SmartAIEventList> SmartAIEventMap;
+typedef std::unordered_map<int32, SmartAIEventListPtr> SmartAIEventMap;
+
+// events of a running script
+typedef std::vector<SmartScriptEvent> SmartScriptEventList;
+typedef std::list<SmartScriptEvent> SmartScriptEventStoredList;
 
 class WH_GAME_API SmartAIMgr
 {
@@ -1979,17 +2022,17 @@ public:
 
     void LoadSmartAIFromDB();
 
-    SmartAIEventList GetScript(int32 entry, SmartScriptType type)
+    // returned list is immutable and shared by every object running the script
+    SmartAIEventListPtr GetScript(int32 entry, SmartScriptType type) const
     {
-        SmartAIEventList temp;
-        if (mEventMap[uint32(type)].find(entry) != mEventMap[uint32(type)].end())
-            return mEventMap[uint32(type)][entry];
-        else
-        {
-            if (entry > 0) //first search is for guid (negative), do not drop error if not found
-                LOG_DEBUG("db.query", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
-            return temp;
-        }
+        auto itr = mEventMap[uint32(type)].find(entry);
+        if (itr != mEventMap[uint32(type)].end())
+            return itr->second;
+
+        if (entry > 0) //first search is for guid (negative), do not drop error if not found
+            LOG_DEBUG("db.query", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
+
+        return nullptr;
     }
 
 private:
@@ -16,11 +16,14 @@
  */
 
 #include "DBCacheMgr.h"
+#include "Config.h"
 #include "DatabaseEnv.h"
 #include "GameConfig.h"
+#include "GitRevision.h"
 #include "Log.h"
 #include "StopWatch.h"
 #include "Util.h"
+#include <filesystem>
 
 /*static*/ DBCacheMgr* DBCacheMgr::instance()
 {
@@ -38,6 +41,7 @@ void DBCacheMgr::Initialize()
     _isEnableWaitAtAdd = CONF_GET_BOOL("DBCache.WaitAtAdd.Enable");
 
     InitializeDefines();
+    InitializeSnapshot();
     InitializeQuery();
 
     LOG_INFO("server.loading", ">> Initialized database cache in {}", sw);
@@ -46,7 +50,7 @@ void DBCacheMgr::Initialize()
 
 void DBCacheMgr::AddQuery(DBCacheTable index)
 {
-    if (!_isEnableAsyncLoad)
+    if (!_isEnableAsyncLoad || (_snapshot && _snapshot->IsLoaded()))
         return;
 
     if (_queryList.contains(index))
@@ -73,6 +77,32 @@ void DBCacheMgr::AddQuery(DBCacheTable index)
 }
 
 QueryResult DBCacheMgr::GetResult(DBCacheTable index)
+{
+    QueryResult result;
+
+    if (_snapshot && _snapshot->GetResult(index, result))
+        return result;
+
+    result = QueryResultFromDB(index);
+
+    if (_snapshot && !_snapshot->IsLoaded())
+        _snapshot->Store(index, result);
+
+    return result;
+}
+
+void DBCacheMgr::CloseSnapshot()
+{
+    if (!_snapshot)
+        return;
+
+    if (!_snapshot->IsLoaded())
+        _snapshot->Write(_snapshotKey);
+
+    _snapshot.reset();
+}
+
+QueryResult DBCacheMgr::QueryResultFromDB(DBCacheTable index)
 {
     if (!_isEnableAsyncLoad)
     {
@@ -86,8 +116,20 @@ QueryResult DBCacheMgr::GetResult(DBCacheTable index)
         return WorldDatabase.Query(sql);
     }
 
-    auto const& itr = _queryList.find(index);
-    if (itr == _queryList.end())
+    QueryResultFuture future;
+
+    {
+        std::lock_guard<std::mutex> guard(_queryListLock);
+
+        auto itr = _queryList.find(index);
+        if (itr != _queryList.end())
+        {
+            future = std::move(itr->second);
+            _queryList.erase(itr);
+        }
+    }
+
+    if (!future.valid())
     {
         LOG_ERROR("db.async", "Not found query with index {}", AsUnderlyingType(index));
 
@@ -101,10 +143,66 @@ QueryResult DBCacheMgr::GetResult(DBCacheTable index)
         return WorldDatabase.Query(sql);
     }
 
-    itr->second.wait();
-    auto result{ itr->second.get() };
-    _queryList.erase(index);
-    return result;
+    future.wait();
+    return future.get();
+}
+
+void DBCacheMgr::InitializeSnapshot()
+{
+    if (!CONF_GET_BOOL("WorldDataSnapshot.Enable"))
+        return;
+
+    std::filesystem::path path{ CONF_GET_STR("WorldDataSnapshot.File") };
+    if (path.is_relative())
+        path = std::filesystem::path(sConfigMgr->GetOption<std::string>("DataDir", "./")) / path;
+
+    _snapshot = std::make_unique<WorldDataSnapshot>(path.generic_string());
+    _snapshotKey = CalculateSnapshotKey();
+    _snapshot->Load(_snapshotKey);
+}
+
+WorldDataSnapshot::Key DBCacheMgr::CalculateSnapshotKey()
+{
+    StopWatch sw;
+
+    Warhead::Crypto::SHA1 hash;
+    hash.UpdateData(GitRevision::GetFullHash());
+
+    for (std::size_t i = 0; i < AsUnderlyingType(DBCacheTable::Max); ++i)
+    {
+        hash.UpdateData(GetStringQuery(DBCacheTable(i)));
+        hash.UpdateData("\n");
+    }
+
+    std::string tables;
+
+    if (auto result = WorldDatabase.Query("SHOW TABLES"))
+    {
+        do
+        {
+            if (!tables.empty())
+                tables += ", ";
+
+            tables += Warhead::StringFormat("`{}`", result->Fetch()[0].Get<std::string_view>());
+        } while (result->NextRow());
+    }
+
+    // Full table scans, still much cheaper than loading all of the rows
+    if (auto result = tables.empty() ? nullptr : WorldDatabase.Query("CHECKSUM TABLE {}", tables))
+    {
+        do
+        {
+            auto fields = result->Fetch();
+            hash.UpdateData(fields[0].Get<std::string_view>());
+            hash.UpdateData(fields[1].Get<std::string_view>());
+            hash.UpdateData("\n");
+        } while (result->NextRow());
+    }
+
+    hash.Finalize();
+
+    LOG_INFO("server.loading", ">> Calculated world data snapshot key in {}", sw);
+    return hash.GetDigest();
 }
 
 std::string_view DBCacheMgr::GetStringQuery(DBCacheTable index)
@@ -20,6 +20,9 @@
 
 #include "DBCacheStrings.h"
 #include "DatabaseEnvFwd.h"
+#include "WorldDataSnapshot.h"
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -37,9 +40,16 @@ public:
     void AddQuery(DBCacheTable index);
     QueryResult GetResult(DBCacheTable index);
 
+    /// Writes the world data snapshot if it had to be rebuilt and stops using it, called once the world is loaded
+    void CloseSnapshot();
+
 private:
     void InitializeDefines();
     void InitializeQuery();
+    void InitializeSnapshot();
+
+    QueryResult QueryResultFromDB(DBCacheTable index);
+    WorldDataSnapshot::Key CalculateSnapshotKey();
 
     //
     void InitGameLocaleStrings();
@@ -57,9 +67,12 @@ private:
     std::string_view GetStringQuery(DBCacheTable index);
 
     std::unordered_map<DBCacheTable, QueryResultFuture> _queryList;
+    std::mutex _queryListLock; // startup loaders take their results from several threads
     std::unordered_map<DBCacheTable, std::string> _queryStrings;
     bool _isEnableAsyncLoad{};
     bool _isEnableWaitAtAdd{};
+    std::unique_ptr<WorldDataSnapshot> _snapshot;
+    WorldDataSnapshot::Key _snapshotKey{};
 
     DBCacheMgr(DBCacheMgr const&) = delete;
     DBCacheMgr(DBCacheMgr&&) = delete;
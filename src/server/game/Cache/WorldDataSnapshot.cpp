@@ -0,0 +1,330 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "WorldDataSnapshot.h"
+#include "Log.h"
+#include "QueryResult.h"
+#include "StopWatch.h"
+#include <algorithm>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 SNAPSHOT_MAGIC = 0x53574857; // 'WHWS'
+    constexpr uint32 SNAPSHOT_VERSION = 1;
+
+    struct SnapshotMapping
+    {
+        SnapshotMapping(std::string const& path) :
+            File(path.c_str(), boost::interprocess::read_only),
+            Region(File, boost::interprocess::read_only) { }
+
+        boost::interprocess::file_mapping File;
+        boost::interprocess::mapped_region Region;
+    };
+
+    class SnapshotReader
+    {
+    public:
+        explicit SnapshotReader(std::string_view data) : _data(data) { }
+
+        bool IsValid() const { return _valid; }
+
+        template<typename T>
+        T Read()
+        {
+            T value{};
+            std::string_view bytes = ReadBytes(sizeof(T));
+            if (_valid)
+                std::memcpy(&value, bytes.data(), sizeof(T));
+
+            return value;
+        }
+
+        std::string_view ReadBytes(std::size_t size)
+        {
+            if (!_valid || size > _data.size() - _position)
+            {
+                _valid = false;
+                return {};
+            }
+
+            std::string_view bytes = _data.substr(_position, size);
+            _position += size;
+            return bytes;
+        }
+
+        std::string ReadString()
+        {
+            return std::string(ReadBytes(Read<uint32>()));
+        }
+
+    private:
+        std::string_view _data;
+        std::size_t _position{};
+        bool _valid{ true };
+    };
+
+    class SnapshotWriter
+    {
+    public:
+        template<typename T>
+        void Write(T value)
+        {
+            _buffer.append(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+
+        void WriteBytes(std::string_view bytes)
+        {
+            _buffer.append(bytes);
+        }
+
+        void WriteString(std::string_view str)
+        {
+            Write<uint32>(uint32(str.size()));
+            WriteBytes(str);
+        }
+
+        std::string const& GetBuffer() const { return _buffer; }
+
+    private:
+        std::string _buffer;
+    };
+}
+
+WorldDataSnapshot::WorldDataSnapshot(std::string path) :
+    _path(std::move(path)) { }
+
+WorldDataSnapshot::~WorldDataSnapshot() = default;
+
+bool WorldDataSnapshot::Load(Key const& key)
+{
+    StopWatch sw;
+
+    std::error_code error;
+    if (!std::filesystem::exists(_path, error) || !std::filesystem::file_size(_path, error))
+    {
+        LOG_INFO("server.loading", ">> World data snapshot {} not found, it will be rebuilt", _path);
+        return false;
+    }
+
+    std::shared_ptr<SnapshotMapping> mapping;
+
+    try
+    {
+        mapping = std::make_shared<SnapshotMapping>(_path);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        LOG_ERROR("server.loading", "> Can't map world data snapshot {}: {}", _path, e.what());
+        return false;
+    }
+
+    SnapshotReader reader({ static_cast<char const*>(mapping->Region.get_address()), mapping->Region.get_size() });
+
+    if (reader.Read<uint32>() != SNAPSHOT_MAGIC || reader.Read<uint32>() != SNAPSHOT_VERSION)
+    {
+        LOG_WARN("server.loading", "> World data snapshot {} has an unknown format, it will be rebuilt", _path);
+        return false;
+    }
+
+    std::string_view storedKey = reader.ReadBytes(key.size());
+    if (!reader.IsValid() || std::memcmp(storedKey.data(), key.data(), key.size()))
+    {
+        LOG_INFO("server.loading", ">> World data snapshot {} is outdated, it will be rebuilt", _path);
+        return false;
+    }
+
+    std::unordered_map<DBCacheTable, Entry> entries;
+    uint64 totalRows{};
+
+    uint32 entryCount = reader.Read<uint32>();
+    for (uint32 i = 0; i < entryCount && reader.IsValid(); ++i)
+    {
+        auto index = DBCacheTable(reader.Read<uint32>());
+
+        auto rows = std::make_shared<ResultSetRows>();
+        rows->RowCount = reader.Read<uint64>();
+        rows->FieldMetadata.resize(reader.Read<uint32>());
+
+        for (auto& meta : rows->FieldMetadata)
+        {
+            meta.TableName = reader.ReadString();
+            meta.TableAlias = reader.ReadString();
+            meta.Name = reader.ReadString();
+            meta.Alias = reader.ReadString();
+            meta.TypeName = reader.ReadString();
+            meta.Index = reader.Read<uint32>();
+            meta.Type = DatabaseFieldTypes(reader.Read<uint8>());
+        }
+
+        rows->Data = reader.ReadBytes(reader.Read<uint64>());
+        rows->Owner = mapping;
+
+        totalRows += rows->RowCount;
+        entries[index].Rows = std::move(rows);
+    }
+
+    if (!reader.IsValid())
+    {
+        LOG_ERROR("server.loading", "> World data snapshot {} is truncated, it will be rebuilt", _path);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _mapping = std::move(mapping);
+    _entries = std::move(entries);
+
+    LOG_INFO("server.loading", ">> Mapped world data snapshot {} ({} queries, {} rows) in {}", _path, _entries.size(), totalRows, sw);
+    return true;
+}
+
+bool WorldDataSnapshot::GetResult(DBCacheTable index, QueryResult& result) const
+{
+    std::shared_ptr<ResultSetRows const> rows;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        auto itr = _entries.find(index);
+        if (itr == _entries.end())
+            return false;
+
+        rows = itr->second.Rows;
+    }
+
+    result = nullptr;
+
+    if (rows->RowCount)
+    {
+        result = std::make_shared<ResultSet>(*rows);
+        result->NextRow();
+    }
+
+    return true;
+}
+
+void WorldDataSnapshot::Store(DBCacheTable index, QueryResult& result)
+{
+    auto rows = std::make_shared<ResultSetRows>();
+    auto data = std::make_shared<std::string>();
+
+    if (result)
+    {
+        rows->FieldMetadata = result->GetFieldMetadata();
+        rows->RowCount = result->SerializeRows(*data);
+        rows->Data = *data;
+        rows->Owner = data;
+
+        result = std::make_shared<ResultSet>(*rows);
+        result->NextRow();
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _entries[index] = { std::move(rows), std::move(data) };
+}
+
+bool WorldDataSnapshot::Write(Key const& key)
+{
+    StopWatch sw;
+
+    SnapshotWriter writer;
+    writer.Write<uint32>(SNAPSHOT_MAGIC);
+    writer.Write<uint32>(SNAPSHOT_VERSION);
+    writer.WriteBytes({ reinterpret_cast<char const*>(key.data()), key.size() });
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        std::vector<DBCacheTable> indexes;
+        indexes.reserve(_entries.size());
+
+        for (auto const& [index, entry] : _entries)
+            indexes.emplace_back(index);
+
+        std::sort(indexes.begin(), indexes.end());
+
+        writer.Write<uint32>(uint32(indexes.size()));
+
+        for (DBCacheTable index : indexes)
+        {
+            ResultSetRows const& rows = *_entries[index].Rows;
+
+            writer.Write<uint32>(uint32(index));
+            writer.Write<uint64>(rows.RowCount);
+            writer.Write<uint32>(uint32(rows.FieldMetadata.size()));
+
+            for (auto const& meta : rows.FieldMetadata)
+            {
+                writer.WriteString(meta.TableName);
+                writer.WriteString(meta.TableAlias);
+                writer.WriteString(meta.Name);
+                writer.WriteString(meta.Alias);
+                writer.WriteString(meta.TypeName);
+                writer.Write<uint32>(meta.Index);
+                writer.Write<uint8>(uint8(meta.Type));
+            }
+
+            writer.Write<uint64>(rows.Data.size());
+            writer.WriteBytes(rows.Data);
+        }
+    }
+
+    std::string tempPath = _path + ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            LOG_ERROR("server.loading", "> Can't create world data snapshot {}", tempPath);
+            return false;
+        }
+
+        file.write(writer.GetBuffer().data(), std::streamsize(writer.GetBuffer().size()));
+        if (!file.flush())
+        {
+            LOG_ERROR("server.loading", "> Can't write world data snapshot {}", tempPath);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, _path, error);
+    if (error)
+    {
+        LOG_ERROR("server.loading", "> Can't replace world data snapshot {}: {}", _path, error.message());
+        return false;
+    }
+
+    LOG_INFO("server.loading", ">> Written world data snapshot {} ({} bytes) in {}", _path, writer.GetBuffer().size(), sw);
+    return true;
+}
+
+void WorldDataSnapshot::Release()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _entries.clear();
+    _mapping.reset();
+}
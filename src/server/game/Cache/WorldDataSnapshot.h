@@ -0,0 +1,77 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WARHEAD_WORLD_DATA_SNAPSHOT_H_
+#define WARHEAD_WORLD_DATA_SNAPSHOT_H_
+
+#include "CryptoHash.h"
+#include "DBCacheStrings.h"
+#include "DatabaseEnvFwd.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct ResultSetRows;
+
+/// On disk copy of the world database query results used at startup.
+/// The file is memory mapped and results are read straight from the mapping,
+/// it is only used when its key matches the current server revision and world database content.
+class WH_GAME_API WorldDataSnapshot
+{
+public:
+    using Key = Warhead::Crypto::SHA1::Digest;
+
+    explicit WorldDataSnapshot(std::string path);
+    ~WorldDataSnapshot();
+
+    /// Maps the snapshot file, returns false when it is missing, broken or written for another key
+    bool Load(Key const& key);
+    bool IsLoaded() const { return _mapping != nullptr; }
+
+    /// Returns true if the snapshot has rows of this query, result is empty when the query returned no rows
+    bool GetResult(DBCacheTable index, QueryResult& result) const;
+
+    /// Copies the rows of result to be written with the next Write and replaces result by a result over the copy
+    void Store(DBCacheTable index, QueryResult& result);
+
+    /// Writes all stored results, replaces the previous file only after the new one is complete
+    bool Write(Key const& key);
+
+    /// Unmaps the file and drops stored results, results still in use keep their memory
+    void Release();
+
+    std::string const& GetPath() const { return _path; }
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<ResultSetRows const> Rows;
+        std::shared_ptr<std::string const> Data;    // owned row data of results stored for writing
+    };
+
+    std::string _path;
+    std::shared_ptr<void const> _mapping;
+    std::unordered_map<DBCacheTable, Entry> _entries;
+    mutable std::mutex _lock;
+
+    WorldDataSnapshot(WorldDataSnapshot const&) = delete;
+    WorldDataSnapshot& operator=(WorldDataSnapshot const&) = delete;
+};
+
+#endif
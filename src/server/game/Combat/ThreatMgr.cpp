@@ -257,6 +257,52 @@ void ThreatContainer::clearReferences()
     }
 
     iThreatList.clear();
+    iIndex.clear();
+    iChanged.clear();
+    iChangedOverflow = false;
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    auto itr = iIndex.find(hostileRef->getUnitGuid());
+    if (itr == iIndex.end() || *itr->second != hostileRef)
+        return;
+
+    iThreatList.erase(itr->second);
+    iIndex.erase(itr);
+    std::erase(iChanged, hostileRef);
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    auto [itr, inserted] = iIndex.try_emplace(hostileRef->getUnitGuid());
+    if (!inserted)
+        return;
+
+    itr->second = iThreatList.insert(iThreatList.end(), hostileRef);
+    markChanged(hostileRef);
+}
+
+//============================================================
+
+void ThreatContainer::markChanged(HostileReference* hostileRef)
+{
+    if (iChangedOverflow)
+        return;
+
+    // past this point a full sort is cheaper than moving every entry
+    if (iChanged.size() >= iThreatList.size() / 4 + 1)
+    {
+        iChanged.clear();
+        iChangedOverflow = true;
+        return;
+    }
+
+    iChanged.push_back(hostileRef);
 }
 
 //============================================================
@@ -271,16 +317,8 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit const* victim) cons
 
 HostileReference* ThreatContainer::getReferenceByTarget(ObjectGuid const& guid) const
 {
-    for (ThreatContainer::StorageType::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        HostileReference* ref = (*i);
-        if (ref && ref->getUnitGuid() == guid)
-        {
-            return ref;
-        }
-    }
-
-    return nullptr;
+    auto itr = iIndex.find(guid);
+    return itr != iIndex.end() ? *itr->second : nullptr;
 }
 
 //============================================================
@@ -307,10 +345,33 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Warhead::ThreatOrderPred());
+    if (!iDirty)
+        return;
 
     iDirty = false;
+
+    if (iThreatList.size() > 1)
+    {
+        if (iChangedOverflow)
+            iThreatList.sort(Warhead::ThreatOrderPred());
+        else if (!iChanged.empty())
+        {
+            // everything else is still sorted, pull the changed entries out and merge them back in
+            std::sort(iChanged.begin(), iChanged.end());
+            iChanged.erase(std::unique(iChanged.begin(), iChanged.end()), iChanged.end());
+
+            StorageType changed;
+            for (HostileReference* ref : iChanged)
+                if (auto itr = iIndex.find(ref->getUnitGuid()); itr != iIndex.end())
+                    changed.splice(changed.end(), iThreatList, itr->second);
+
+            changed.sort(Warhead::ThreatOrderPred());
+            iThreatList.merge(changed, Warhead::ThreatOrderPred());
+        }
+    }
+
+    iChanged.clear();
+    iChangedOverflow = false;
 }
 
 //============================================================
@@ -594,6 +655,8 @@ void ThreatMgr::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStatusCh
     switch (threatRefStatusChangeEvent->getType())
     {
         case UEV_THREAT_REF_THREAT_CHANGE:
+            if (hostileRef->IsOnline())
+                iThreatContainer.markChanged(hostileRef);
             if ((getCurrentVictim() == hostileRef && threatRefStatusChangeEvent->getFValue() < 0.0f) ||
                     (getCurrentVictim() != hostileRef && threatRefStatusChangeEvent->getFValue() > 0.0f))
                 setDirty(true);                             // the order in the threat list might have changed
@@ -24,6 +24,8 @@
 #include "SharedDefines.h"
 #include "UnitEvents.h"
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 //==============================================================
 
@@ -139,12 +141,16 @@ private:
 //==============================================================
 class ThreatMgr;
 
+// The list is kept in a std::list because scripts iterate it while adding threat,
+// which may link new references. Lookups go through a guid index and re-sorting
+// only moves the references whose threat changed since the last sort.
 class WH_GAME_API ThreatContainer
 {
     friend class ThreatMgr;
 
 public:
     typedef std::list<HostileReference*> StorageType;
+    typedef std::unordered_map<ObjectGuid, StorageType::iterator> IndexType;
 
     ThreatContainer() = default;
 
@@ -176,15 +182,12 @@ public:
     [[nodiscard]] StorageType const& GetThreatList() const { return iThreatList; }
 
 private:
-    void remove(HostileReference* hostileRef)
-    {
-        iThreatList.remove(hostileRef);
-    }
+    void remove(HostileReference* hostileRef);
 
-    void addReference(HostileReference* hostileRef)
-    {
-        iThreatList.push_back(hostileRef);
-    }
+    void addReference(HostileReference* hostileRef);
+
+    // Remember a reference whose position in the sorted list may be outdated
+    void markChanged(HostileReference* hostileRef);
 
     void clearReferences();
 
@@ -192,6 +195,9 @@ private:
     void update();
 
     StorageType iThreatList;
+    IndexType iIndex;
+    std::vector<HostileReference*> iChanged;
+    bool iChangedOverflow{false};
     bool iDirty{false};
 };
 
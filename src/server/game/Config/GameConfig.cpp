@@ -28,6 +28,17 @@
 #include "StringConvert.h"
 #include "World.h"
 
+GameConfig::GameConfig() :
+    _values(std::make_unique<std::atomic<OptionValue const*>[]>(MAX_OPTIONS))
+{
+}
+
+GameConfig::~GameConfig()
+{
+    for (OptionHandle handle = 0; handle < _options.size(); ++handle)
+        delete _values[handle].load(std::memory_order_relaxed);
+}
+
 GameConfig* GameConfig::instance()
 {
     static GameConfig instance;
@@ -48,24 +59,11 @@ void GameConfig::Load(bool reload)
 template<Warhead::Types::ConfigValue T>
 void GameConfig::AddOption(std::string_view optionName, Optional<T> def /*= std::nullopt*/)
 {
-    // copy from string_view
-    std::string option{optionName};
-
-    // Check exist option
-    {
-        std::shared_lock cacheLock(_mutex);
+    bool added = false;
+    RegisterOption(optionName, Warhead::Config::GetDefaultValueString<T>(def), added);
 
-        auto const &itr = _configOptions.find(option);
-        if (itr != _configOptions.end())
-        {
-            LOG_ERROR("server.loading", "> GameConfig::AddOption: option ({}) is already exists", optionName);
-            return;
-        }
-    }
-
-    // Emplace option if no exist
-    std::unique_lock cacheLock(_mutex);
-    _configOptions.emplace(option, sConfigMgr->GetOption<std::string>(option, Warhead::Config::GetDefaultValueString<T>(def)));
+    if (!added)
+        LOG_ERROR("server.loading", "> GameConfig::AddOption: option ({}) is already exists", optionName);
 }
 
 // Add option without template
@@ -84,110 +82,141 @@ void GameConfig::AddOption(std::initializer_list<std::string> const& optionList)
 template<Warhead::Types::ConfigValue T>
 T GameConfig::GetOption(std::string_view optionName, Optional<T> def /*= std::nullopt*/)
 {
-    // copy from string_view
-    std::string option{ optionName };
+    return GetOption<T>(GetHandle<T>(optionName, def));
+}
 
-    // Check exist option part 1
-    auto itr = _configOptions.find(option);
-    if (itr == _configOptions.end())
-    {
-        AddOption(optionName, def);
-        itr = _configOptions.find(option);
-    }
+template<Warhead::Types::ConfigValue T>
+GameConfig::OptionHandle GameConfig::GetHandle(std::string_view optionName, Optional<T> def /*= std::nullopt*/)
+{
+    if (Optional<OptionHandle> handle = FindOption(optionName))
+        return *handle;
 
-    std::string defStr = Warhead::Config::GetDefaultValueString(def);
+    bool added = false;
+    return RegisterOption(optionName, Warhead::Config::GetDefaultValueString<T>(def), added);
+}
 
-    // Check exist option part 2
-    if (itr == _configOptions.end())
+// Set option
+template<Warhead::Types::ConfigValue T>
+void GameConfig::SetOption(std::string_view optionName, T value)
+{
+    Optional<OptionHandle> handle = FindOption(optionName);
+    if (!handle)
     {
-        LOG_CRIT("server.loading", "> GameConfig::GetOption: option ({}) is not exists. Returned ({})", optionName, defStr);
-        return Warhead::Config::GetDefaultValue<T>();
+        LOG_ERROR("server.loading", "> GameConfig::SetOption: option ({}) is not exists", optionName);
+        return;
     }
 
-    Optional<T> result;
+    std::string valueStr;
+
+    if constexpr (std::is_same_v<T, std::string>)
+        valueStr = value;
+    else
+        valueStr = Warhead::ToString(value);
+
+    std::unique_lock lock(_mutex);
+    StoreValue(*handle, std::move(valueStr));
+}
 
+template<Warhead::Types::ConfigValue T>
+Optional<T> GameConfig::ParseValue(std::string const& rawValue)
+{
     if constexpr (std::is_same_v<T, std::string>)
-        result = itr->second;
+        return rawValue;
     else
-        result = Warhead::StringTo<T>(itr->second);
+        return Warhead::StringTo<T>(rawValue);
+}
 
-    if (!result)
+template<Warhead::Types::ConfigValue T>
+T GameConfig::GetBadValue(OptionHandle handle) const
+{
+    // _options may be reallocated by a concurrent RegisterOption
+    std::string optionName;
     {
-        LOG_ERROR("server.loading", "> GameConfig::GetOption: Bad value defined for '{}', use '{}' instead", optionName, defStr);
-        return Warhead::Config::GetDefaultValue<T>();
+        std::shared_lock lock(_mutex);
+        optionName = _options[handle].Name;
     }
 
-    return *result;
+    LOG_ERROR("server.loading", "> GameConfig::GetOption: Bad value defined for '{}', use '{}' instead",
+        optionName, Warhead::Config::GetDefaultValueString<T>(std::nullopt));
+
+    return Warhead::Config::GetDefaultValue<T>();
 }
 
-// Set option
-template<Warhead::Types::ConfigValue T>
-void GameConfig::SetOption(std::string_view optionName, T value)
+Optional<GameConfig::OptionHandle> GameConfig::FindOption(std::string_view optionName)
 {
-    // copy from string_view
-    std::string option{ optionName };
+    std::shared_lock lock(_mutex);
 
-    // Check exist option
-    {
-        std::shared_lock cacheLock(_mutex);
+    auto itr = _handles.find(optionName);
+    if (itr == _handles.end())
+        return std::nullopt;
 
-        auto const &itr = _configOptions.find(option);
-        if (itr == _configOptions.end())
-        {
-            LOG_ERROR("server.loading", "> GameConfig::SetOption: option ({}) is not exists", optionName);
-            return;
-        }
-    }
+    return itr->second;
+}
 
-    std::unique_lock cacheLock(_mutex);
-    std::string valueStr;
+GameConfig::OptionHandle GameConfig::RegisterOption(std::string_view optionName, std::string const& defaultValue, bool& added)
+{
+    std::unique_lock lock(_mutex);
 
-    if constexpr (std::is_same_v<T, std::string>)
-        valueStr = value;
-    else
-        valueStr = Warhead::ToString(value);
+    auto [itr, inserted] = _handles.try_emplace(std::string(optionName), OptionHandle(_options.size()));
+    added = inserted;
+    if (!inserted)
+        return itr->second;
+
+    ASSERT(_options.size() < MAX_OPTIONS, "GameConfig: too many options, increase MAX_OPTIONS");
+
+    _options.push_back({ itr->first, defaultValue });
+    StoreValue(itr->second, sConfigMgr->GetOption<std::string>(itr->first, defaultValue));
+    return itr->second;
+}
 
-    _configOptions.erase(option);
-    _configOptions.emplace(option, valueStr);
+void GameConfig::StoreValue(OptionHandle handle, std::string rawValue)
+{
+    auto value = std::make_unique<OptionValue>();
+    value->Bool = Warhead::StringTo<bool>(rawValue);
+    value->Int = Warhead::StringTo<int32>(rawValue);
+    value->UInt = Warhead::StringTo<uint32>(rawValue);
+    value->Float = Warhead::StringTo<float>(rawValue);
+    value->Raw = std::move(rawValue);
+
+    if (OptionValue const* old = _values[handle].exchange(value.release(), std::memory_order_acq_rel))
+        _retiredValues.emplace_back(old);
 }
 
 // Loading
 void GameConfig::LoadConfigs(bool reload /*= false*/)
 {
-    std::unordered_map<std::string, int32> _notChangeConfigs;
+    if (!reload)
+        return;
 
-    if (reload)
+    std::unordered_map<std::string, int32> _notChangeConfigs =
     {
-        _notChangeConfigs =
-        {
-            { "WorldServerPort", GetOption<int32>("WorldServerPort") },
-            { "GameType", GetOption<int32>("GameType") },
-            { "RealmZone", GetOption<int32>("RealmZone") },
-            { "MaxPlayerLevel", GetOption<int32>("MaxPlayerLevel") },
-            { "Expansion", GetOption<int32>("Expansion") }
-        };
-    }
+        { "WorldServerPort", GetOption<int32>("WorldServerPort") },
+        { "GameType", GetOption<int32>("GameType") },
+        { "RealmZone", GetOption<int32>("RealmZone") },
+        { "MaxPlayerLevel", GetOption<int32>("MaxPlayerLevel") },
+        { "Expansion", GetOption<int32>("Expansion") }
+    };
 
-    _configOptions.clear();
+    // re-read every known option, handles held by callers stay valid
+    {
+        std::unique_lock lock(_mutex);
 
-    if (reload)
-        AddOption<int32>("ClientCacheVersion");
+        for (OptionHandle handle = 0; handle < _options.size(); ++handle)
+            StoreValue(handle, sConfigMgr->GetOption<std::string>(_options[handle].Name, _options[handle].Default));
+    }
 
     // Check options can't be changed at worldserver.conf reload
-    if (reload)
+    for (auto const& [optionName, optionValue] : _notChangeConfigs)
     {
-        for (auto const& [optionName, optionValue] : _notChangeConfigs)
-        {
-            int32 configValue = sConfigMgr->GetOption(optionName, optionValue);
+        int32 configValue = sConfigMgr->GetOption(optionName, optionValue);
 
-            if (configValue != optionValue)
-                LOG_ERROR("server.loading", "{} option can't be changed at worldserver.conf reload, using current value ({})", optionName, optionValue);
+        if (configValue != optionValue)
+            LOG_ERROR("server.loading", "{} option can't be changed at worldserver.conf reload, using current value ({})", optionName, optionValue);
 
-            AddOption<int32>(optionName, optionValue);
-        }
+        SetOption<int32>(optionName, optionValue);
     }
 
-    LOG_INFO("server.loading", "> Loaded {} config options", _configOptions.size());
+    LOG_INFO("server.loading", "> Loaded {} config options", _options.size());
 }
 
 void GameConfig::CheckOptions(bool reload /*= false*/)
@@ -556,8 +585,12 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 }
 
 #define TEMPLATE_GAME_CONFIG_OPTION(__typename) \
+    template WH_GAME_API void GameConfig::AddOption(std::string_view optionName, Optional<__typename> def /*= std::nullopt*/); \
     template WH_GAME_API __typename GameConfig::GetOption(std::string_view optionName, Optional<__typename> def /*= std::nullopt*/); \
-    template WH_GAME_API void GameConfig::SetOption(std::string_view optionName, __typename value);
+    template WH_GAME_API GameConfig::OptionHandle GameConfig::GetHandle(std::string_view optionName, Optional<__typename> def /*= std::nullopt*/); \
+    template WH_GAME_API void GameConfig::SetOption(std::string_view optionName, __typename value); \
+    template WH_GAME_API Optional<__typename> GameConfig::ParseValue(std::string const& rawValue); \
+    template WH_GAME_API __typename GameConfig::GetBadValue(OptionHandle handle) const;
 
 TEMPLATE_GAME_CONFIG_OPTION(bool)
 TEMPLATE_GAME_CONFIG_OPTION(uint8)
@@ -21,20 +21,48 @@
 #include "Define.h"
 #include "Optional.h"
 #include "Types.h"
+#include <atomic>
+#include <memory>
 #include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 class WH_GAME_API GameConfig
 {
+    // Option value, parsed once when the option is loaded or changed.
+    // Published values are never modified, changes publish a new value.
+    struct OptionValue
+    {
+        std::string Raw;
+        Optional<bool> Bool;
+        Optional<int32> Int;
+        Optional<uint32> UInt;
+        Optional<float> Float;
+    };
+
+    struct StringHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const { return std::hash<std::string_view>{}(str); }
+    };
+
+    static constexpr uint32 MAX_OPTIONS = 4096;
+
     GameConfig(GameConfig const&) = delete;
     GameConfig(GameConfig&&) = delete;
     GameConfig& operator= (GameConfig const&) = delete;
     GameConfig& operator= (GameConfig&&) = delete;
 
-    GameConfig() = default;
-    ~GameConfig() = default;
+    GameConfig();
+    ~GameConfig();
 
 public:
+    // Index of a registered option, stays valid for the whole process lifetime (including reloads)
+    typedef uint32 OptionHandle;
+
     static GameConfig* instance();
 
     void Load(bool reload);
@@ -54,6 +82,37 @@ public:
     template<Warhead::Types::ConfigValue T>
     T GetOption(std::string_view optionName, Optional<T> = std::nullopt);
 
+    // Resolve an option once, registering it if needed
+    template<Warhead::Types::ConfigValue T>
+    OptionHandle GetHandle(std::string_view optionName, Optional<T> def = std::nullopt);
+
+    // Read an already resolved option, an atomic pointer load and no string work
+    template<Warhead::Types::ConfigValue T>
+    T GetOption(OptionHandle handle) const
+    {
+        OptionValue const* value = _values[handle].load(std::memory_order_acquire);
+
+        Optional<T> result;
+
+        if constexpr (std::is_same_v<T, bool>)
+            result = value->Bool;
+        else if constexpr (std::is_same_v<T, int32>)
+            result = value->Int;
+        else if constexpr (std::is_same_v<T, uint32>)
+            result = value->UInt;
+        else if constexpr (std::is_same_v<T, float>)
+            result = value->Float;
+        else if constexpr (std::is_same_v<T, std::string>)
+            result = value->Raw;
+        else
+            result = ParseValue<T>(value->Raw);
+
+        if (!result)
+            return GetBadValue<T>(handle);
+
+        return *result;
+    }
+
     // Set config option
     template<Warhead::Types::ConfigValue T>
     void SetOption(std::string_view optionName, T value);
@@ -61,16 +120,60 @@ public:
 private:
     void LoadConfigs(bool reload = false);
 
-    std::unordered_map<std::string /*name*/, std::string /*value*/> _configOptions;
-    std::shared_mutex _mutex;
+    // Registers an option read from the config files, returns the existing handle if already known
+    OptionHandle RegisterOption(std::string_view optionName, std::string const& defaultValue, bool& added);
+    Optional<OptionHandle> FindOption(std::string_view optionName);
+
+    // Publishes a new value for an option and retires the old one, callers hold _mutex exclusively
+    void StoreValue(OptionHandle handle, std::string rawValue);
+
+    template<Warhead::Types::ConfigValue T>
+    static Optional<T> ParseValue(std::string const& rawValue);
+
+    template<Warhead::Types::ConfigValue T>
+    T GetBadValue(OptionHandle handle) const;
+
+    struct OptionInfo
+    {
+        std::string Name;
+        std::string Default;
+    };
+
+    // name -> handle, only used when resolving names
+    std::unordered_map<std::string, OptionHandle, StringHash, std::equal_to<>> _handles;
+    std::vector<OptionInfo> _options;
+
+    // handle -> current value, fixed capacity so readers never race a reallocation
+    std::unique_ptr<std::atomic<OptionValue const*>[]> _values;
+
+    // Replaced values, a reader racing the change may still hold them. Readers take no lock and
+    // publish nothing, so nothing tells when the last one is done: they are kept until shutdown.
+    // That is one value of about a hundred bytes per option and reload (or SetOption).
+    std::vector<std::unique_ptr<OptionValue const>> _retiredValues;
+
+    mutable std::shared_mutex _mutex;
 };
 
 #define sGameConfig GameConfig::instance()
 
-#define CONF_GET_BOOL(__optionName) sGameConfig->GetOption<bool>(__optionName)
-#define CONF_GET_STR(__optionName) sGameConfig->GetOption<std::string>(__optionName)
-#define CONF_GET_INT(__optionName) sGameConfig->GetOption<int32>(__optionName)
-#define CONF_GET_UINT(__optionName) sGameConfig->GetOption<uint32>(__optionName)
-#define CONF_GET_FLOAT(__optionName) sGameConfig->GetOption<float>(__optionName)
+// Options named by a string literal resolve their handle once per call site,
+// other names (built at runtime) go through the name lookup every time
+#define CONF_GET_OPTION(__type, __optionName) \
+    [&]() -> __type \
+    { \
+        if constexpr (std::is_array_v<std::remove_reference_t<decltype(__optionName)>>) \
+        { \
+            static GameConfig::OptionHandle const handle = sGameConfig->GetHandle<__type>(__optionName); \
+            return sGameConfig->GetOption<__type>(handle); \
+        } \
+        else \
+            return sGameConfig->GetOption<__type>(__optionName); \
+    }()
+
+#define CONF_GET_BOOL(__optionName) CONF_GET_OPTION(bool, __optionName)
+#define CONF_GET_STR(__optionName) CONF_GET_OPTION(std::string, __optionName)
+#define CONF_GET_INT(__optionName) CONF_GET_OPTION(int32, __optionName)
+#define CONF_GET_UINT(__optionName) CONF_GET_OPTION(uint32, __optionName)
+#define CONF_GET_FLOAT(__optionName) CONF_GET_OPTION(float, __optionName)
 
 #endif // __GAME_CONFIG
@@ -25,6 +25,7 @@
 #include "Log.h"
 #include "Opcodes.h"
 #include "WorldPacket.h"
+#include <atomic>
 #include <zlib.h>
 
 UpdateData::UpdateData() : m_blockCount(0)
@@ -49,16 +50,100 @@ void UpdateData::AddUpdateBlock(const UpdateData& block)
     m_blockCount += block.m_blockCount;
 }
 
-void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+// Packets smaller than this gain next to nothing from a level above Z_BEST_SPEED
+#define UPDATE_COMPRESSION_FULL_LEVEL_MIN_SIZE 1024
+// Above this average world update time (ms) every packet is compressed with Z_BEST_SPEED
+#define UPDATE_COMPRESSION_HIGH_LOAD_UPDATE_TIME 75
+
+namespace
 {
-    z_stream c_stream;
+    // published by the world thread, sWorldUpdateTime itself is not safe to read from map threads
+    std::atomic<uint32> AverageWorldUpdateTime{ 0 };
+
+    // deflateInit allocates ~256KB of window and hash tables, so each thread building
+    // update packets keeps its stream alive and only resets it between packets
+    class UpdateCompressor
+    {
+    public:
+        UpdateCompressor() : _level(-1)
+        {
+            _stream.zalloc = (alloc_func)0;
+            _stream.zfree = (free_func)0;
+            _stream.opaque = (voidpf)0;
+        }
+
+        ~UpdateCompressor()
+        {
+            if (_level >= 0)
+                deflateEnd(&_stream);
+        }
+
+        UpdateCompressor(UpdateCompressor const&) = delete;
+        UpdateCompressor& operator=(UpdateCompressor const&) = delete;
+
+        int Prepare(int level)
+        {
+            if (_level < 0)
+            {
+                int z_res = deflateInit(&_stream, level);
+                if (z_res == Z_OK)
+                    _level = level;
+
+                return z_res;
+            }
+
+            int z_res = deflateReset(&_stream);
+            if (z_res != Z_OK)
+            {
+                deflateEnd(&_stream);
+                _level = -1;
+                return z_res;
+            }
+
+            if (_level != level)
+            {
+                // Stream was just reset, so no pending input gets flushed here
+                z_res = deflateParams(&_stream, level, Z_DEFAULT_STRATEGY);
+                if (z_res != Z_OK)
+                    return z_res;
+
+                _level = level;
+            }
+
+            return Z_OK;
+        }
+
+        z_stream& GetStream() { return _stream; }
+
+    private:
+        z_stream _stream;
+        int _level;
+    };
+
+    int SelectCompressionLevel(int srcSize)
+    {
+        // default Z_BEST_SPEED (1)
+        int level = CONF_GET_INT("Compression");
+        if (level <= Z_BEST_SPEED)
+            return level;
 
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree = (free_func)0;
-    c_stream.opaque = (voidpf)0;
+        if (srcSize < UPDATE_COMPRESSION_FULL_LEVEL_MIN_SIZE || AverageWorldUpdateTime.load(std::memory_order_relaxed) > UPDATE_COMPRESSION_HIGH_LOAD_UPDATE_TIME)
+            return Z_BEST_SPEED;
 
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, CONF_GET_INT("Compression"));
+        return level;
+    }
+}
+
+void UpdateData::SetAverageWorldUpdateTime(uint32 updateTime)
+{
+    AverageWorldUpdateTime.store(updateTime, std::memory_order_relaxed);
+}
+
+void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+{
+    thread_local UpdateCompressor compressor;
+
+    int z_res = compressor.Prepare(SelectCompressionLevel(src_size));
     if (z_res != Z_OK)
     {
         LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
@@ -66,26 +151,13 @@ void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
+    z_stream& c_stream = compressor.GetStream();
     c_stream.next_out = (Bytef*)dst;
     c_stream.avail_out = *dst_size;
     c_stream.next_in = (Bytef*)src;
     c_stream.avail_in = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    if (c_stream.avail_in != 0)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
-        *dst_size = 0;
-        return;
-    }
-
+    // dst is sized with compressBound, so a single call consumes all input
     z_res = deflate(&c_stream, Z_FINISH);
     if (z_res != Z_STREAM_END)
     {
@@ -94,14 +166,6 @@ void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
     *dst_size = c_stream.total_out;
 }
 
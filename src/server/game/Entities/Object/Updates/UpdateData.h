@@ -60,6 +60,9 @@ public:
     [[nodiscard]] bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty(); }
     void Clear();
 
+    // Called by the world once per update, map threads pick the compression level from it
+    static void SetAverageWorldUpdateTime(uint32 updateTime);
+
 protected:
     uint32 m_blockCount;
     GuidVector m_outOfRangeGUIDs;
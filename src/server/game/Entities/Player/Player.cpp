@@ -68,6 +68,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "PetitionMgr.h"
+#include "PlayerSaveScheduler.h"
 #include "QueryHolder.h"
 #include "QuestDef.h"
 #include "Realm.h"
@@ -189,6 +190,8 @@ Player::Player(WorldSession* session): Unit(true), m_mover(this)
 
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
+    // commits of saves made by an earlier object of this character are older and ignored
+    m_savedRows.Generation = NextSavedRowsGeneration();
     m_hostileReferenceCheckTimer = 15000;
 
     clearResurrectRequestData();
@@ -412,6 +415,8 @@ Player::~Player()
 {
     sScriptMgr->OnDestructPlayer(this);
 
+    sPlayerSaveScheduler->CancelSave(m_autosaveDueTime);
+
     // it must be unloaded already in PlayerLogout and accessed only for loggined player
     //m_social = nullptr;
 
@@ -3573,10 +3578,6 @@ void Player::_LoadSpellCooldowns(PreparedQueryResult result)
 
 void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
     time_t curTime = GameTime::GetGameTime().count();
     uint32 curMSTime = GameTime::GetGameTimeMS().count();
     uint32 infTime = curMSTime + infinityCooldownDelayCheck;
@@ -3614,9 +3615,20 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout
         else
             ++itr;
     }
+    // rows are rewritten only when they differ from the last committed save
+    std::string cooldowns = ss.str();
+    if (SavedRows const* committed = GetCommittedSavedRows(); committed && committed->SpellCooldowns == cooldowns)
+        return;
+
+    CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
+    stmt->SetData(0, GetGUID().GetCounter());
+    trans->Append(stmt);
+
     // if something changed execute
     if (!first_round)
-        trans->Append(ss.str().c_str());
+        trans->Append(cooldowns);
+
+    GetPendingSavedRows().SpellCooldowns = std::move(cooldowns);
 }
 
 uint32 Player::resetTalentsCost() const
@@ -4619,7 +4631,7 @@ void Player::SpawnCorpseBones(bool triggerSave /*= true*/)
 
             _SaveAuras(trans, false);
 
-            CharacterDatabase.CommitTransaction(trans);
+            GetSession()->AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete(TakeSaveCommitCallback());
         }
 }
 
@@ -14539,11 +14551,7 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
-    CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
+    CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     stmt->SetData (1, m_entryPointData.joinPos.GetPositionX());
     stmt->SetData (2, m_entryPointData.joinPos.GetPositionY());
@@ -14553,6 +14561,11 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(6, m_entryPointData.taxiPath[0]);
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
+
+    if (SavedRows const* committed = GetCommittedSavedRows(); committed && stmt->GetParameters() == committed->EntryPoint)
+        return;
+
+    GetPendingSavedRows().EntryPoint = stmt->GetParameters();
     trans->Append(stmt);
 }
 
@@ -15810,6 +15823,11 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
+    if (SavedRows const* committed = GetCommittedSavedRows(); committed && _instanceResetTimes == committed->InstanceResetTimes)
+        return;
+
+    GetPendingSavedRows().InstanceResetTimes = _instanceResetTimes;
+
     CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
     trans->Append(stmt);
@@ -33,6 +33,7 @@
 #include "Optional.h"
 #include "PetDefines.h"
 #include "PlayerTaxi.h"
+#include "PreparedStatement.h"
 #include "QuestDef.h"
 #include "SpellAuras.h"
 #include "SpellInfo.h"
@@ -1550,6 +1551,8 @@ public:
 
     void SaveToDB(bool create, bool logout);
     void SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout);
+    /// Callback for the commit of the transaction saved to last, the next saves compare against its rows once it is committed
+    std::function<void(bool)> TakeSaveCommitCallback();
     void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
     void SaveGoldToDB(CharacterDatabaseTransaction trans);
 
@@ -2338,6 +2341,7 @@ public:
     // currently visible objects at player client
     GuidUnorderedSet m_clientGUIDs;
     std::vector<Unit*> m_newVisible; // pussywizard
+    Milliseconds m_visibilityFullUpdateTime{}; // game time of the last full relocation update, see Visibility.Delta
 
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
     [[nodiscard]] bool HaveAtClient(ObjectGuid guid) const;
@@ -2713,8 +2717,31 @@ public:
 
     TeamId m_team;
     uint32 m_nextSave; // pussywizard
+    TimePoint m_autosaveDueTime; // set while the autosave waits in PlayerSaveScheduler
     uint16 m_additionalSaveTimer; // pussywizard
     uint8 m_additionalSaveMask; // pussywizard
+
+    // Parameters of the rows written by a save, rows unchanged since the last committed save are not written again
+    // unless another save is still being committed, see GetCommittedSavedRows
+    using SavedAuraKey = std::tuple<uint64 /*casterGuid*/, uint64 /*itemGuid*/, uint32 /*spell*/, uint8 /*effectMask*/>;
+    struct SavedRows
+    {
+        uint64 Generation{ 0 };                     // orders the saves of all players, later saves have larger values
+        std::map<SavedAuraKey, std::vector<PreparedStatementData>> Auras;
+        bool AurasSaved{ false };                   // the first save after login replaces all aura rows
+        std::vector<PreparedStatementData> Stats;
+        std::vector<PreparedStatementData> EntryPoint;
+        Optional<std::string> SpellCooldowns;
+        InstanceTimeMap InstanceResetTimes;
+    };
+
+    static uint64 NextSavedRowsGeneration();
+    SavedRows& GetPendingSavedRows();
+    [[nodiscard]] SavedRows const* GetCommittedSavedRows() const;
+
+    SavedRows m_savedRows;                          // rows of the last committed save
+    std::shared_ptr<SavedRows> m_pendingSavedRows;  // rows of the save being written, see TakeSaveCommitCallback
+    std::set<uint64> m_uncommittedSaves;            // generations of the saves written but not committed yet
     uint16 m_hostileReferenceCheckTimer; // pussywizard
     std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
     Difficulty m_dungeonDifficulty;
@@ -0,0 +1,180 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "PlayerSaveScheduler.h"
+#include "DatabaseEnv.h"
+#include "GameConfig.h"
+#include "Metric.h"
+#include "World.h"
+#include <algorithm>
+
+PlayerSaveScheduler* PlayerSaveScheduler::instance()
+{
+    static PlayerSaveScheduler instance;
+    return &instance;
+}
+
+void PlayerSaveScheduler::LoadFromConfig()
+{
+    _enabled.store(CONF_GET_BOOL("PlayerSaveScheduler.Enable"), std::memory_order_relaxed);
+    _maxInFlight.store(std::max<uint32>(CONF_GET_UINT("PlayerSaveScheduler.MaxInFlight"), 1), std::memory_order_relaxed);
+    _maxQueueSize.store(CONF_GET_UINT("PlayerSaveScheduler.MaxQueueSize"), std::memory_order_relaxed);
+}
+
+bool PlayerSaveScheduler::TryStartSave(TimePoint& dueTime)
+{
+    TimePoint now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    if (_enabled.load(std::memory_order_relaxed))
+    {
+        if (_queueFull || _inFlight >= _maxInFlight.load(std::memory_order_relaxed) || _budget < 1.0)
+        {
+            if (dueTime == TimePoint())
+            {
+                dueTime = now;
+                ++_backlog;
+            }
+
+            return false;
+        }
+
+        _budget -= 1.0;
+    }
+
+    ++_inFlight;
+
+    if (dueTime != TimePoint())
+    {
+        _maxWait = std::max(_maxWait, std::chrono::duration_cast<Milliseconds>(now - dueTime));
+        dueTime = TimePoint();
+        --_backlog;
+    }
+
+    return true;
+}
+
+void PlayerSaveScheduler::CancelSave(TimePoint& dueTime)
+{
+    if (dueTime == TimePoint())
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    dueTime = TimePoint();
+    --_backlog;
+}
+
+void PlayerSaveScheduler::Commit(CharacterDatabaseTransaction trans, std::function<void(bool)> callback)
+{
+    // player could not be saved now, see Player::SaveToDB
+    if (!trans->GetSize())
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        --_inFlight;
+        return;
+    }
+
+    PendingCommit commit{ CharacterDatabase.AsyncCommitTransaction(std::move(trans))._future, std::chrono::steady_clock::now(), std::move(callback) };
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _newCommits.emplace_back(std::move(commit));
+}
+
+void PlayerSaveScheduler::Update(Milliseconds diff)
+{
+    // enough saves to save every online player once per interval, with a quarter more to work off waiting saves
+    int32 interval = CONF_GET_INT("PlayerSaveInterval");
+    double rate = interval > 0 ? double(std::max<uint32>(sWorld->GetPlayerCount(), 1)) / interval : 0.0;
+
+    uint32 maxQueueSize = _maxQueueSize.load(std::memory_order_relaxed);
+    bool queueFull = maxQueueSize && CharacterDatabase.GetQueueSize() >= maxQueueSize;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        // at most one second of saves at once
+        _budget = std::min(_budget + rate * 1.25 * double(diff.count()), std::max(1.0, rate * 1000.0));
+        _queueFull = queueFull;
+
+        std::move(_newCommits.begin(), _newCommits.end(), std::back_inserter(_commits));
+        _newCommits.clear();
+    }
+
+    TimePoint now = std::chrono::steady_clock::now();
+    uint32 completed{};
+
+    for (auto itr = _commits.begin(); itr != _commits.end();)
+    {
+        if (itr->Result.wait_for(0s) != std::future_status::ready)
+        {
+            ++itr;
+            continue;
+        }
+
+        Milliseconds commitTime = std::chrono::duration_cast<Milliseconds>(now - itr->Start);
+        _commitTime += commitTime;
+        _maxCommitTime = std::max(_maxCommitTime, commitTime);
+        ++_committed;
+        ++completed;
+
+        itr->Callback(itr->Result.get());
+        itr = _commits.erase(itr);
+    }
+
+    if (completed)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _inFlight -= completed;
+    }
+
+    _metricTimer += diff;
+    if (_metricTimer < 1s)
+        return;
+
+    _metricTimer = 0ms;
+
+    [[maybe_unused]] uint32 backlog{};
+    [[maybe_unused]] uint32 inFlight{};
+    [[maybe_unused]] Milliseconds maxWait{};
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        backlog = _backlog;
+        inFlight = _inFlight;
+        maxWait = _maxWait;
+        _maxWait = 0ms;
+    }
+
+    METRIC_VALUE("player_save_backlog", uint64(backlog));
+    METRIC_VALUE("player_save_in_flight", uint64(inFlight));
+    METRIC_VALUE("player_save_wait", uint64(maxWait.count()));
+
+    if (_committed)
+    {
+        METRIC_VALUE("player_save_commit_time", uint64(_commitTime.count() / _committed));
+        METRIC_VALUE("player_save_commit_time_max", uint64(_maxCommitTime.count()));
+    }
+
+    _commitTime = 0ms;
+    _maxCommitTime = 0ms;
+    _committed = 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WARHEAD_PLAYER_SAVE_SCHEDULER_H
+#define WARHEAD_PLAYER_SAVE_SCHEDULER_H
+
+#include "DatabaseEnvFwd.h"
+#include "Duration.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/// Paces player autosaves. Due autosaves take one save from a budget that grows with the online players
+/// over PlayerSaveInterval, and wait while too many autosaves are committing or the character database
+/// queue is long. Logout and other explicit saves never wait here, they go first.
+class WH_GAME_API PlayerSaveScheduler
+{
+public:
+    static PlayerSaveScheduler* instance();
+
+    void LoadFromConfig();
+
+    /// Map threads, returns false when the autosave has to wait. dueTime is the player's state,
+    /// set while its autosave waits
+    bool TryStartSave(TimePoint& dueTime);
+
+    /// Forgets a waiting autosave, the player was saved another way or logged out
+    void CancelSave(TimePoint& dueTime);
+
+    /// Commits an autosave started with TryStartSave, the callback runs in the world thread once the commit is done
+    void Commit(CharacterDatabaseTransaction trans, std::function<void(bool)> callback);
+
+    /// World thread, refills the budget, completes finished commits and sends metrics
+    void Update(Milliseconds diff);
+
+private:
+    PlayerSaveScheduler() = default;
+
+    struct PendingCommit
+    {
+        TransactionFuture Result;
+        TimePoint Start;
+        std::function<void(bool)> Callback;
+    };
+
+    std::atomic<bool> _enabled{ false };
+    std::atomic<uint32> _maxInFlight{ 0 };
+    std::atomic<uint32> _maxQueueSize{ 0 };
+
+    std::mutex _lock;
+    double _budget{ 0.0 };                      // autosaves that may start now
+    uint32 _inFlight{ 0 };
+    uint32 _backlog{ 0 };                       // players with a due autosave waiting
+    bool _queueFull{ false };                   // character database queue length, checked once per world update
+    Milliseconds _maxWait{ 0 };
+    std::vector<PendingCommit> _newCommits;
+
+    // world thread only
+    std::vector<PendingCommit> _commits;
+    Milliseconds _metricTimer{ 0 };
+    Milliseconds _commitTime{ 0 };
+    Milliseconds _maxCommitTime{ 0 };
+    uint32 _committed{ 0 };
+};
+
+#define sPlayerSaveScheduler PlayerSaveScheduler::instance()
+
+#endif
@@ -51,12 +51,14 @@
 #include "Log.h"
 #include "LootItemStorage.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "OutdoorPvP.h"
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveScheduler.h"
 #include "QueryHolder.h"
 #include "QuestDef.h"
 #include "ReputationMgr.h"
@@ -75,6 +77,7 @@
 #include "Weather.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <atomic>
 #include <sstream>
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
@@ -7079,13 +7082,68 @@ void Player::SaveToDB(bool create, bool logout)
 
     SaveToDB(trans, create, logout);
 
-    CharacterDatabase.CommitTransaction(trans);
+    GetSession()->AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete(TakeSaveCommitCallback());
+}
+
+uint64 Player::NextSavedRowsGeneration()
+{
+    static std::atomic<uint64> generation{ 0 };
+    return ++generation;
+}
+
+Player::SavedRows& Player::GetPendingSavedRows()
+{
+    // starts from the committed rows, the save only replaces the parts it wrote
+    if (!m_pendingSavedRows)
+    {
+        m_pendingSavedRows = std::make_shared<SavedRows>(m_savedRows);
+        m_pendingSavedRows->Generation = NextSavedRowsGeneration();
+    }
+
+    return *m_pendingSavedRows;
+}
+
+Player::SavedRows const* Player::GetCommittedSavedRows() const
+{
+    // rows written by a save still being committed are in none of m_savedRows, comparing with it could skip
+    // a row that save changes (or miss deleting a row it adds), so everything is written until it commits
+    if (!m_uncommittedSaves.empty())
+        return nullptr;
+
+    return &m_savedRows;
+}
+
+std::function<void(bool)> Player::TakeSaveCommitCallback()
+{
+    // every saved row was unchanged
+    if (!m_pendingSavedRows)
+        return [](bool) { };
+
+    m_uncommittedSaves.insert(m_pendingSavedRows->Generation);
+
+    return [guid = GetGUID(), rows = std::move(m_pendingSavedRows)](bool success)
+    {
+        Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+        if (!player)
+            return;
+
+        player->m_uncommittedSaves.erase(rows->Generation);
+
+        // a failed commit leaves the committed rows as they are, so the next save writes the rows again
+        if (!success)
+            return;
+
+        // commits can complete out of order, older rows must not replace newer ones
+        if (rows->Generation > player->m_savedRows.Generation)
+            player->m_savedRows = std::move(*rows);
+    };
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout)
 {
     // delay auto save at any saves (manual, in code, or autosave)
     m_nextSave = CONF_GET_INT("PlayerSaveInterval");
+    sPlayerSaveScheduler->CancelSave(m_autosaveDueTime);
 
     //lets allow only players in world to be saved
     if (IsBeingTeleportedFar())
@@ -7094,6 +7152,8 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
         return;
     }
 
+    [[maybe_unused]] std::size_t const firstQuery = trans->GetSize();
+
     // pussywizard: full save now, so clear partial additional saves
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
@@ -7107,6 +7167,7 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     if (!create)
         sScriptMgr->OnPlayerSave(this);
 
+    // not compared with the previous save like the rows below, the played time and logout time change every save
     _SaveCharacter(create, trans);
 
     if (m_mailsUpdated)                                     //save mails only when needed
@@ -7137,6 +7198,9 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     if (m_session->isLogingOut() || !CONF_GET_BOOL("PlayerSave.Stats.SaveOnlyOnLogout"))
         _SaveStats(trans);
 
+    METRIC_VALUE("player_save_statements", uint64(trans->GetSize() - firstQuery), METRIC_TAG("type", logout ? "logout" : "save"));
+    METRIC_VALUE("player_save_bytes", uint64(trans->GetDataSize(firstQuery)), METRIC_TAG("type", logout ? "logout" : "save"));
+
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
         pet->SavePetToDB(PET_SAVE_AS_CURRENT);
@@ -7207,9 +7271,23 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    CharacterDatabasePreparedStatement stmt = nullptr;
+
+    // rows are compared with the last committed save. Before the first one after login, or while another save
+    // is being committed, all rows are replaced. The remaining duration is part of the row, so only auras
+    // without a duration are ever skipped.
+    SavedRows const* committed = GetCommittedSavedRows();
+    if (committed && !committed->AurasSaved)
+        committed = nullptr;
+
+    if (!committed)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+        stmt->SetData(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+    }
+
+    decltype(SavedRows::Auras) savedAuras;
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -7242,7 +7320,7 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         }
 
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_AURA);
         stmt->SetData(index++, GetGUID().GetCounter());
         stmt->SetData(index++, itr->second->GetCasterGUID().GetRawValue());
         stmt->SetData(index++, itr->second->GetCastItemGUID().GetRawValue());
@@ -7259,8 +7337,37 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         stmt->SetData(index++, itr->second->GetMaxDuration());
         stmt->SetData(index++, itr->second->GetDuration());
         stmt->SetData(index, itr->second->GetCharges());
-        trans->Append(stmt);
+
+        SavedAuraKey key{ itr->second->GetCasterGUID().GetRawValue(), itr->second->GetCastItemGUID().GetRawValue(), itr->second->GetId(), effMask };
+
+        auto const* saved = committed ? Warhead::Containers::MapGetValuePtr(committed->Auras, key) : nullptr;
+        if (!saved || *saved != stmt->GetParameters())
+            trans->Append(stmt);
+
+        savedAuras.emplace(key, stmt->GetParameters());
+    }
+
+    // rows of the committed save that are gone or are not saved any more
+    if (committed)
+    {
+        for (auto const& [key, parameters] : committed->Auras)
+        {
+            if (savedAuras.count(key))
+                continue;
+
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_CASTER_SPELL);
+            stmt->SetData(0, GetGUID().GetCounter());
+            stmt->SetData(1, std::get<0>(key));
+            stmt->SetData(2, std::get<1>(key));
+            stmt->SetData(3, std::get<2>(key));
+            stmt->SetData(4, std::get<3>(key));
+            trans->Append(stmt);
+        }
     }
+
+    SavedRows& pendingRows = GetPendingSavedRows();
+    pendingRows.Auras = std::move(savedAuras);
+    pendingRows.AurasSaved = true;
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
@@ -7770,15 +7877,9 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     if (!CONF_GET_INT("PlayerSave.Stats.MinLevel") || GetLevel() < CONF_GET_INT("PlayerSave.Stats.MinLevel"))
         return;
 
-    CharacterDatabasePreparedStatement stmt = nullptr;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
+    CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_STATS);
     stmt->SetData(index++, GetGUID().GetCounter());
     stmt->SetData(index++, GetMaxHealth());
 
@@ -7802,6 +7903,10 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     stmt->SetData(index++, GetBaseSpellPowerBonus());
     stmt->SetData(index++, GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + static_cast<uint16>(CR_CRIT_TAKEN_SPELL)));
 
+    if (SavedRows const* committed = GetCommittedSavedRows(); committed && stmt->GetParameters() == committed->Stats)
+        return;
+
+    GetPendingSavedRows().Stats = stmt->GetParameters();
     trans->Append(stmt);
 }
 
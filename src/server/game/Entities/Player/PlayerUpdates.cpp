@@ -37,6 +37,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveScheduler.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SpellAuraEffects.h"
@@ -307,9 +308,16 @@ void Player::Update(uint32 p_time)
     {
         if (p_time >= m_nextSave)
         {
-            // m_nextSave reset in SaveToDB call
-            SaveToDB(false, false);
-            LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
+            if (sPlayerSaveScheduler->TryStartSave(m_autosaveDueTime))
+            {
+                // m_nextSave reset in SaveToDB call
+                CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+                SaveToDB(trans, false, false);
+                sPlayerSaveScheduler->Commit(trans, TakeSaveCommitCallback());
+                LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
+            }
+            else
+                m_nextSave = 1; // ask again at the next update
         }
         else
         {
@@ -1440,6 +1448,8 @@ void Player::UpdateVisibilityForPlayer(bool mapChange)
     Cell::VisitAllObjects(m_seer, notifierLarge, GetSightRange());
     notifierLarge.SendToSelf();
 
+    m_visibilityFullUpdateTime = GameTime::GetGameTimeMS();
+
     if (mapChange)
         m_last_notify_position.Relocate(-5000.0f, -5000.0f, -5000.0f, 0.0f);
 }
@@ -15666,6 +15666,9 @@ void Unit::AddToWorld()
     if (!IsInWorld())
     {
         WorldObject::AddToWorld();
+
+        if (UnitSpatialIndex* index = GetMap()->GetUnitSpatialIndex())
+            index->Insert(this);
     }
 }
 
@@ -15710,6 +15713,9 @@ void Unit::RemoveFromWorld()
             }
         }
 
+        if (m_spatialIndexSlot.Index)
+            m_spatialIndexSlot.Index->Remove(this);
+
         WorldObject::RemoveFromWorld();
         m_duringRemoveFromWorld = false;
     }
@@ -20801,6 +20807,8 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
         if (viewPoint->GetMapId() != player->GetMapId() || !viewPoint->IsPositionValid() || !player->IsPositionValid())
             return;
 
+        Position const lastNotifyPosition = player->m_last_notify_position;
+
         if (Unit* active = viewPoint->ToUnit())
         {
             if (active->IsVehicle())
@@ -20821,15 +20829,39 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
             }
         }
 
-        Warhead::PlayerRelocationNotifier relocateNoLarge(*player, false); // visit only objects which are not large; default distance
-        Cell::VisitAllObjects(viewPoint, relocateNoLarge, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
-        relocateNoLarge.SendToSelf();
+        bool updated = false;
 
-        if (!player->GetFarSightDistance())
+        // only check the objects whose visibility the move may have changed
+        if (Warhead::PlayerRelocationDeltaNotifier::CanUse(*player, lastNotifyPosition))
         {
-            Warhead::PlayerRelocationNotifier relocateLarge(*player, true); // visit only large objects; maximum distance
-            Cell::VisitAllObjects(viewPoint, relocateLarge, MAX_VISIBILITY_DISTANCE);
+            VisibilityDelta const deltaNoLarge(lastNotifyPosition, *player, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS + player->GetCombatReach());
+            Warhead::PlayerRelocationDeltaNotifier relocateNoLarge(*player, deltaNoLarge, false);
+            relocateNoLarge.VisitCells(*player->GetMap());
+            relocateNoLarge.SendToSelf();
+
+            VisibilityDelta const deltaLarge(lastNotifyPosition, *player, MAX_VISIBILITY_DISTANCE + player->GetCombatReach());
+            Warhead::PlayerRelocationDeltaNotifier relocateLarge(*player, deltaLarge, true);
+            relocateLarge.VisitCells(*player->GetMap());
             relocateLarge.SendToSelf();
+
+            // objects at the client outside of the visited cells are removed by the full update below
+            updated = VisibilityDelta::CoversClient(relocateNoLarge.i_clientObjects + relocateLarge.i_clientObjects, player->m_clientGUIDs.size());
+        }
+
+        if (!updated)
+        {
+            Warhead::PlayerRelocationNotifier relocateNoLarge(*player, false); // visit only objects which are not large; default distance
+            Cell::VisitAllObjects(viewPoint, relocateNoLarge, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
+            relocateNoLarge.SendToSelf();
+
+            if (!player->GetFarSightDistance())
+            {
+                Warhead::PlayerRelocationNotifier relocateLarge(*player, true); // visit only large objects; maximum distance
+                Cell::VisitAllObjects(viewPoint, relocateLarge, MAX_VISIBILITY_DISTANCE);
+                relocateLarge.SendToSelf();
+            }
+
+            player->m_visibilityFullUpdateTime = GameTime::GetGameTimeMS();
         }
 
         this->AddToNotify(NOTIFY_AI_RELOCATION);
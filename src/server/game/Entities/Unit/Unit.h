@@ -30,6 +30,7 @@
 #include "SpellAuraDefines.h"
 #include "SpellDefines.h"
 #include "ThreatMgr.h"
+#include "UnitSpatialIndex.h"
 #include <functional>
 #include <utility>
 
@@ -1302,6 +1303,8 @@ private:
 
 class WH_GAME_API Unit : public WorldObject
 {
+    friend class UnitSpatialIndex;
+
 public:
     typedef std::unordered_set<Unit*> AttackerSet;
     typedef std::set<Unit*> ControlSet;
@@ -2614,6 +2617,8 @@ private:
     uint32 _lastExtraAttackSpell;
     std::unordered_map<ObjectGuid /*guid*/, uint32 /*count*/> extraAttacksTargets;
     ObjectGuid _lastDamagedTargetGuid;
+
+    UnitSpatialIndexSlot m_spatialIndexSlot;
 };
 
 namespace Warhead
@@ -45,6 +45,7 @@
 #include "ObjectAccessor.h"
 #include "Pet.h"
 #include "PoolMgr.h"
+#include "QueryResultFetch.h"
 #include "ReputationMgr.h"
 #include "ScriptMgr.h"
 #include "ScriptObject.h"
@@ -1983,16 +1984,48 @@ void ObjectMgr::LoadCreatures()
                 if (GetMapDifficultyData(i, Difficulty(k)))
                     spawnMasks[i] |= (1 << k);
 
-    _creatureDataStore.rehash(result->GetRowCount());
+    struct CreatureRow
+    {
+        uint32 SpawnId;
+        uint32 Id1;
+        uint32 Id2;
+        uint32 Id3;
+        uint16 MapId;
+        int8 EquipmentId;
+        float PosX;
+        float PosY;
+        float PosZ;
+        float Orientation;
+        uint32 SpawnTimeSecs;
+        float WanderDistance;
+        uint32 CurrentWaypoint;
+        uint32 CurHealth;
+        uint32 CurMana;
+        uint8 MovementType;
+        uint8 SpawnMask;
+        uint32 PhaseMask;
+        int8 GameEvent;
+        uint32 PoolId;
+        uint32 NpcFlag;
+        uint32 UnitFlags;
+        uint32 DynamicFlags;
+        std::string ScriptName;
+    };
+
+    auto rows = FetchRows<&CreatureRow::SpawnId, &CreatureRow::Id1, &CreatureRow::Id2, &CreatureRow::Id3, &CreatureRow::MapId,
+        &CreatureRow::EquipmentId, &CreatureRow::PosX, &CreatureRow::PosY, &CreatureRow::PosZ, &CreatureRow::Orientation,
+        &CreatureRow::SpawnTimeSecs, &CreatureRow::WanderDistance, &CreatureRow::CurrentWaypoint, &CreatureRow::CurHealth,
+        &CreatureRow::CurMana, &CreatureRow::MovementType, &CreatureRow::SpawnMask, &CreatureRow::PhaseMask, &CreatureRow::GameEvent,
+        &CreatureRow::PoolId, &CreatureRow::NpcFlag, &CreatureRow::UnitFlags, &CreatureRow::DynamicFlags, &CreatureRow::ScriptName>(*result);
+
+    _creatureDataStore.rehash(rows.size());
     uint32 count = 0;
-    do
+    for (CreatureRow const& row : rows)
     {
-        auto fields = result->Fetch();
-
-        ObjectGuid::LowType spawnId     = fields[0].Get<uint32>();
-        uint32 id1                      = fields[1].Get<uint32>();
-        uint32 id2                      = fields[2].Get<uint32>();
-        uint32 id3                      = fields[3].Get<uint32>();
+        ObjectGuid::LowType spawnId     = row.SpawnId;
+        uint32 id1                      = row.Id1;
+        uint32 id2                      = row.Id2;
+        uint32 id3                      = row.Id3;
 
         CreatureTemplate const* cInfo = GetCreatureTemplate(id1);
         if (!cInfo)
@@ -2021,26 +2054,26 @@ void ObjectMgr::LoadCreatures()
         data.id1                = id1;
         data.id2                = id2;
         data.id3                = id3;
-        data.mapid              = fields[4].Get<uint16>();
-        data.equipmentId        = fields[5].Get<int8>();
-        data.posX               = fields[6].Get<float>();
-        data.posY               = fields[7].Get<float>();
-        data.posZ               = fields[8].Get<float>();
-        data.orientation        = fields[9].Get<float>();
-        data.spawntimesecs      = fields[10].Get<uint32>();
-        data.wander_distance    = fields[11].Get<float>();
-        data.currentwaypoint    = fields[12].Get<uint32>();
-        data.curhealth          = fields[13].Get<uint32>();
-        data.curmana            = fields[14].Get<uint32>();
-        data.movementType       = fields[15].Get<uint8>();
-        data.spawnMask          = fields[16].Get<uint8>();
-        data.phaseMask          = fields[17].Get<uint32>();
-        int16 gameEvent         = fields[18].Get<int8>();
-        uint32 PoolId           = fields[19].Get<uint32>();
-        data.npcflag            = fields[20].Get<uint32>();
-        data.unit_flags         = fields[21].Get<uint32>();
-        data.dynamicflags       = fields[22].Get<uint32>();
-        data.ScriptId           = GetScriptId(fields[23].Get<std::string>());
+        data.mapid              = row.MapId;
+        data.equipmentId        = row.EquipmentId;
+        data.posX               = row.PosX;
+        data.posY               = row.PosY;
+        data.posZ               = row.PosZ;
+        data.orientation        = row.Orientation;
+        data.spawntimesecs      = row.SpawnTimeSecs;
+        data.wander_distance    = row.WanderDistance;
+        data.currentwaypoint    = row.CurrentWaypoint;
+        data.curhealth          = row.CurHealth;
+        data.curmana            = row.CurMana;
+        data.movementType       = row.MovementType;
+        data.spawnMask          = row.SpawnMask;
+        data.phaseMask          = row.PhaseMask;
+        int16 gameEvent         = row.GameEvent;
+        uint32 PoolId           = row.PoolId;
+        data.npcflag            = row.NpcFlag;
+        data.unit_flags         = row.UnitFlags;
+        data.dynamicflags       = row.DynamicFlags;
+        data.ScriptId           = GetScriptId(row.ScriptName);
 
         if (!data.ScriptId)
             data.ScriptId = cInfo->ScriptID;
@@ -2143,7 +2176,7 @@ void ObjectMgr::LoadCreatures()
             AddCreatureToGrid(spawnId, &data);
 
         ++count;
-    } while (result->NextRow());
+    }
 
     LOG_INFO("server.loading", ">> Loaded {} Creatures in {}", count, sw);
     LOG_INFO("server.loading", " ");
@@ -2303,14 +2336,40 @@ void ObjectMgr::LoadGameobjects()
             if (GetMapDifficultyData(map->MapID, Difficulty(k)))
                 spawnMasks[map->MapID] |= (1 << k);
 
-    _gameObjectDataStore.rehash(result->GetRowCount());
+    struct GameObjectRow
+    {
+        uint32 Guid;
+        uint32 Entry;
+        uint16 MapId;
+        float PosX;
+        float PosY;
+        float PosZ;
+        float Orientation;
+        float RotationX;
+        float RotationY;
+        float RotationZ;
+        float RotationW;
+        int32 SpawnTimeSecs;
+        uint8 AnimProgress;
+        uint8 State;
+        uint8 SpawnMask;
+        uint32 PhaseMask;
+        int8 GameEvent;
+        uint32 PoolId;
+        std::string ScriptName;
+    };
 
-    do
-    {
-        auto fields = result->Fetch();
+    auto rows = FetchRows<&GameObjectRow::Guid, &GameObjectRow::Entry, &GameObjectRow::MapId, &GameObjectRow::PosX, &GameObjectRow::PosY,
+        &GameObjectRow::PosZ, &GameObjectRow::Orientation, &GameObjectRow::RotationX, &GameObjectRow::RotationY, &GameObjectRow::RotationZ,
+        &GameObjectRow::RotationW, &GameObjectRow::SpawnTimeSecs, &GameObjectRow::AnimProgress, &GameObjectRow::State, &GameObjectRow::SpawnMask,
+        &GameObjectRow::PhaseMask, &GameObjectRow::GameEvent, &GameObjectRow::PoolId, &GameObjectRow::ScriptName>(*result);
 
-        ObjectGuid::LowType guid    = fields[0].Get<uint32>();
-        uint32 entry                = fields[1].Get<uint32>();
+    _gameObjectDataStore.rehash(rows.size());
+
+    for (GameObjectRow const& row : rows)
+    {
+        ObjectGuid::LowType guid    = row.Guid;
+        uint32 entry                = row.Entry;
 
         GameObjectTemplate const* gInfo = GetGameObjectTemplate(entry);
         if (!gInfo)
@@ -2341,17 +2400,17 @@ void ObjectMgr::LoadGameobjects()
         GameObjectData& data = _gameObjectDataStore[guid];
 
         data.id             = entry;
-        data.mapid          = fields[2].Get<uint16>();
-        data.posX           = fields[3].Get<float>();
-        data.posY           = fields[4].Get<float>();
-        data.posZ           = fields[5].Get<float>();
-        data.orientation    = fields[6].Get<float>();
-        data.rotation.x     = fields[7].Get<float>();
-        data.rotation.y     = fields[8].Get<float>();
-        data.rotation.z     = fields[9].Get<float>();
-        data.rotation.w     = fields[10].Get<float>();
-        data.spawntimesecs  = fields[11].Get<int32>();
-        data.ScriptId       = GetScriptId(fields[18].Get<std::string>());
+        data.mapid          = row.MapId;
+        data.posX           = row.PosX;
+        data.posY           = row.PosY;
+        data.posZ           = row.PosZ;
+        data.orientation    = row.Orientation;
+        data.rotation.x     = row.RotationX;
+        data.rotation.y     = row.RotationY;
+        data.rotation.z     = row.RotationZ;
+        data.rotation.w     = row.RotationW;
+        data.spawntimesecs  = row.SpawnTimeSecs;
+        data.ScriptId       = GetScriptId(row.ScriptName);
         if (!data.ScriptId)
             data.ScriptId = gInfo->ScriptId;
 
@@ -2367,10 +2426,10 @@ void ObjectMgr::LoadGameobjects()
             LOG_ERROR("db.query", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with `spawntimesecs` (0) value, but the gameobejct is marked as despawnable at action.", guid, data.id);
         }
 
-        data.animprogress   = fields[12].Get<uint8>();
+        data.animprogress   = row.AnimProgress;
         data.artKit         = 0;
 
-        uint32 go_state     = fields[13].Get<uint8>();
+        uint32 go_state     = row.State;
         if (go_state >= MAX_GO_STATE)
         {
             LOG_ERROR("db.query", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid `state` ({}) value, skip", guid, data.id, go_state);
@@ -2378,14 +2437,14 @@ void ObjectMgr::LoadGameobjects()
         }
         data.go_state       = GOState(go_state);
 
-        data.spawnMask      = fields[14].Get<uint8>();
+        data.spawnMask      = row.SpawnMask;
 
         if (!_transportMaps.count(data.mapid) && data.spawnMask & ~spawnMasks[data.mapid])
             LOG_ERROR("db.query", "Table `gameobject` has gameobject (GUID: {} Entry: {}) that has wrong spawn mask {} including not supported difficulty modes for map (Id: {}), skip", guid, data.id, data.spawnMask, data.mapid);
 
-        data.phaseMask      = fields[15].Get<uint32>();
-        int16 gameEvent     = fields[16].Get<int8>();
-        uint32 PoolId        = fields[17].Get<uint32>();
+        data.phaseMask      = row.PhaseMask;
+        int16 gameEvent     = row.GameEvent;
+        uint32 PoolId       = row.PoolId;
 
         if (data.rotation.x < -1.0f || data.rotation.x > 1.0f)
         {
@@ -2440,7 +2499,7 @@ void ObjectMgr::LoadGameobjects()
         if (gameEvent == 0 && PoolId == 0)                      // if not this is to be managed by GameEvent System or Pool system
             AddGameobjectToGrid(guid, &data);
         ++count;
-    } while (result->NextRow());
+    }
 
     LOG_INFO("server.loading", ">> Loaded {} Gameobjects in {}", (unsigned long)_gameObjectDataStore.size(), sw);
     LOG_INFO("server.loading", " ");
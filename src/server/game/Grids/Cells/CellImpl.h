@@ -21,6 +21,7 @@
 #include "Cell.h"
 #include "Map.h"
 #include "Object.h"
+#include "UnitSpatialIndex.h"
 #include <cmath>
 
 inline Cell::Cell(CellCoord const& p)
@@ -206,6 +207,16 @@ inline void Cell::VisitWorldObjects(WorldObject const* center_obj, T& visitor, f
 template<class T>
 inline void Cell::VisitAllObjects(WorldObject const* center_obj, T& visitor, float radius, bool dont_load /*= true*/)
 {
+    // unit searchers can use the map unit index, it only holds units in world so it never loads grids
+    if constexpr (Warhead::IndexedUnitVisitor<T>)
+    {
+        if (UnitSpatialIndex const* index = center_obj->GetMap()->GetUnitSpatialIndex(); index && dont_load && radius > 0.0f)
+        {
+            index->Visit(center_obj->GetPositionX(), center_obj->GetPositionY(), radius + center_obj->GetCombatReach(), [&visitor](Unit* unit) { return visitor.VisitUnit(unit); });
+            return;
+        }
+    }
+
     CellCoord p(Warhead::ComputeCellCoord(center_obj->GetPositionX(), center_obj->GetPositionY()));
     Cell cell(p);
     if (dont_load)
@@ -250,6 +261,15 @@ inline void Cell::VisitWorldObjects(float x, float y, Map* map, T& visitor, floa
 template<class T>
 inline void Cell::VisitAllObjects(float x, float y, Map* map, T& visitor, float radius, bool dont_load /*= true*/)
 {
+    if constexpr (Warhead::IndexedUnitVisitor<T>)
+    {
+        if (UnitSpatialIndex const* index = map->GetUnitSpatialIndex(); index && dont_load && radius > 0.0f)
+        {
+            index->Visit(x, y, radius, [&visitor](Unit* unit) { return visitor.VisitUnit(unit); });
+            return;
+        }
+    }
+
     CellCoord p(Warhead::ComputeCellCoord(x, y));
     Cell cell(p);
     if (dont_load)
@@ -20,6 +20,11 @@
 
 #include "GridNotifiers.h"
 #include "CellImpl.h"
+#include "CinematicMgr.h"
+#include "DynamicVisibility.h"
+#include "GameConfig.h"
+#include "GameTime.h"
+#include "GridNotifiersImpl.h"
 #include "Map.h"
 #include "ObjectAccessor.h"
 #include "SpellMgr.h"
@@ -181,6 +186,144 @@ void PlayerRelocationNotifier::Visit(PlayerMapType& m)
     }
 }
 
+PlayerRelocationDeltaNotifier::PlayerRelocationDeltaNotifier(Player& player, VisibilityDelta const& delta, bool largeOnly) :
+    i_player(player), i_delta(delta), i_visibleNow(player.m_newVisible), i_largeOnly(largeOnly), i_checked(0), i_skipped(0), i_clientObjects(0)
+{
+    uint32 const mapType = player.FindMap()->GetEntry()->map_type;
+    i_reqMoveDist = std::sqrt(DynamicVisibilityMgr::GetReqMoveDistSq(mapType));
+    i_notifyDelay = DynamicVisibilityMgr::GetVisibilityNotifyDelay(mapType) / float(IN_MILLISECONDS);
+    i_visibleNow.clear();
+}
+
+bool PlayerRelocationDeltaNotifier::CanUse(Player const& player, Position const& lastNotifyPosition)
+{
+    if (!CONF_GET_BOOL("Visibility.Delta.Enable"))
+        return false;
+
+    // what these players see does not only depend on where they stand
+    if (player.m_seer != &player || player.GetFarSightDistance() || player.GetTransport() || player.isDead() || player.GetCinematicMgr()->IsOnCinematic())
+        return false;
+
+    // others detect stealth and invisibility depending on the distance, not only on the visibility range
+    if (player.m_stealth.GetFlags() || player.m_invisibility.GetFlags())
+        return false;
+
+    // teleports and resets of the last notify position
+    if (player.GetExactDistSq(lastNotifyPosition) > SIZE_OF_GRID_CELL * SIZE_OF_GRID_CELL)
+        return false;
+
+    // a full update from time to time picks up changes which do not come from moving
+    return GameTime::GetGameTimeMS() < player.m_visibilityFullUpdateTime + Milliseconds(CONF_GET_UINT("Visibility.Delta.FullUpdateInterval"));
+}
+
+void PlayerRelocationDeltaNotifier::VisitCells(Map& map)
+{
+    TypeContainerVisitor<PlayerRelocationDeltaNotifier, WorldTypeMapContainer> worldVisitor(*this);
+    TypeContainerVisitor<PlayerRelocationDeltaNotifier, GridTypeMapContainer> gridVisitor(*this);
+
+    CellArea const& area = i_delta.GetArea();
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            CellCoord const cellCoord(x, y);
+            if (i_delta.GetCellChange(cellCoord) == VisibilityDelta::CELL_OUTSIDE)
+                continue;
+
+            Cell cell(cellCoord);
+            cell.SetNoCreate();
+            map.Visit(cell, worldVisitor);
+            map.Visit(cell, gridVisitor);
+        }
+    }
+}
+
+void PlayerRelocationDeltaNotifier::Visit(PlayerMapType& m)
+{
+    for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Player* player = iter->GetSource();
+        if (player == &i_player)
+            continue;
+
+        if (MayChange(player))
+            i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+
+        // players are visited by both notifiers, they are counted by the one which handles their size
+        if (i_largeOnly == player->IsVisibilityOverridden())
+            CountClientObject(player);
+
+        // how the other player sees us, see PlayerRelocationNotifier::Visit
+        if (player->m_seer != player || player->GetFarSightDistance() || player->GetTransport() || player->isDead() ||
+            i_delta.NeedsCheck(*player, player->GetSightRange(&i_player) + player->GetObjectSize() + i_player.GetObjectSize(), GetDrift(player), player->HaveAtClient(&i_player)))
+            player->UpdateVisibilityOf(&i_player);
+    }
+}
+
+void PlayerRelocationDeltaNotifier::SendToSelf()
+{
+    i_player.GetMap()->AddVisibilityDeltaChecks(i_checked, i_skipped);
+
+    if (!i_data.HasData())
+        return;
+
+    WorldPacket packet;
+    i_data.BuildPacket(&packet);
+    i_player.GetSession()->SendPacket(&packet);
+
+    for (Unit* unit : i_visibleNow)
+    {
+        if (i_largeOnly != unit->IsVisibilityOverridden())
+            continue;
+
+        i_player.GetInitialVisiblePackets(unit);
+    }
+}
+
+inline bool IsVisibilityVolatile(WorldObject const* target)
+{
+    // stealth and invisibility detection depend on more than the visibility range
+    if (target->m_stealth.GetFlags() || target->m_invisibility.GetFlags())
+        return true;
+
+    // passengers move with their transport without notifying
+    if (target->GetTransport() || (target->GetTypeId() == TYPEID_GAMEOBJECT && target->ToGameObject()->IsTransport()))
+        return true;
+
+    // vehicle accessories are only visible together with their vehicle
+    return target->isType(TYPEMASK_UNIT) && target->ToUnit()->GetVehicleBase();
+}
+
+bool PlayerRelocationDeltaNotifier::MayChange(WorldObject const* target)
+{
+    bool const mayChange = IsVisibilityVolatile(target) ||
+        i_delta.NeedsCheck(*target, i_player.GetSightRange(target) + i_player.GetObjectSize() + target->GetObjectSize(), GetDrift(target), i_player.HaveAtClient(target));
+
+    ++(mayChange ? i_checked : i_skipped);
+    return mayChange;
+}
+
+void PlayerRelocationDeltaNotifier::CountClientObject(WorldObject const* target)
+{
+    // only what is in m_clientGUIDs, HaveAtClient also accepts ourself and motion transports
+    if (i_player.m_clientGUIDs.find(target->GetGUID()) != i_player.m_clientGUIDs.end())
+        ++i_clientObjects;
+}
+
+float PlayerRelocationDeltaNotifier::GetDrift(WorldObject const* target) const
+{
+    // gameobjects, dynamic objects and corpses stay where they are
+    Unit const* unit = target->ToUnit();
+    if (!unit)
+        return 0.0f;
+
+    // a unit updates the visibility around it once it moved the required distance, at most one notify delay late
+    if (unit->isMoving() || !unit->IsStopped() || unit->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+        return i_reqMoveDist + std::max({ unit->GetSpeed(MOVE_RUN), unit->GetSpeed(MOVE_SWIM), unit->GetSpeed(MOVE_FLIGHT) }) * i_notifyDelay;
+
+    return i_reqMoveDist;
+}
+
 void CreatureRelocationNotifier::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -30,6 +30,7 @@
 #include "Spell.h"
 #include "Unit.h"
 #include "UpdateData.h"
+#include "VisibilityDelta.h"
 
 class Player;
 
@@ -74,6 +75,37 @@ namespace Warhead
         void Visit(PlayerMapType&);
     };
 
+    // Relocation of a player which only checks the objects the move may have shown or hidden,
+    // see VisibilityDelta. The full notifier is still used when the move is not the only thing
+    // that can change what the player sees (far sight, transports, stealth, ...).
+    struct PlayerRelocationDeltaNotifier
+    {
+        Player& i_player;
+        VisibilityDelta const& i_delta;
+        std::vector<Unit*>& i_visibleNow;
+        bool i_largeOnly;
+        float i_reqMoveDist;
+        float i_notifyDelay;
+        uint32 i_checked;
+        uint32 i_skipped;
+        uint32 i_clientObjects;                     // visited objects at the client after the update, see VisibilityDelta::CoversClient
+        UpdateData i_data;
+
+        PlayerRelocationDeltaNotifier(Player& player, VisibilityDelta const& delta, bool largeOnly);
+
+        template<class T> void Visit(GridRefMgr<T>& m);
+        void Visit(PlayerMapType&);
+        void VisitCells(Map& map);
+        void SendToSelf();
+
+        static bool CanUse(Player const& player, Position const& lastNotifyPosition);
+
+    private:
+        bool MayChange(WorldObject const* target);
+        void CountClientObject(WorldObject const* target);
+        [[nodiscard]] float GetDrift(WorldObject const* target) const;
+    };
+
     struct CreatureRelocationNotifier
     {
         Creature& i_creature;
@@ -94,7 +126,7 @@ namespace Warhead
     struct MessageDistDeliverer
     {
         WorldObject const* i_source;
-        WorldPacket const* i_message;
+        SharedWorldPacket i_message;
         uint32 i_phaseMask;
         float i_distSq;
         TeamId teamId;
@@ -126,7 +158,7 @@ namespace Warhead
     struct MessageDistDelivererToHostile
     {
         Unit* i_source;
-        WorldPacket* i_message;
+        SharedWorldPacket i_message;
         uint32 i_phaseMask;
         float i_distSq;
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
@@ -390,6 +422,7 @@ namespace Warhead
 
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
+        bool VisitUnit(Unit* unit);
 
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
@@ -407,6 +440,7 @@ namespace Warhead
 
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
+        bool VisitUnit(Unit* unit);
 
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
@@ -425,6 +459,7 @@ namespace Warhead
 
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
+        bool VisitUnit(Unit* unit);
 
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
@@ -43,6 +43,21 @@ inline void Warhead::VisibleNotifier::Visit(GridRefMgr<T>& m)
     }
 }
 
+template<class T>
+inline void Warhead::PlayerRelocationDeltaNotifier::Visit(GridRefMgr<T>& m)
+{
+    for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        if (i_largeOnly != iter->GetSource()->IsVisibilityOverridden())
+            continue;
+
+        if (MayChange(iter->GetSource()))
+            i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
+
+        CountClientObject(iter->GetSource());
+    }
+}
+
 // SEARCHERS & LIST SEARCHERS & WORKERS
 
 // WorldObject searchers & workers
@@ -383,6 +398,24 @@ void Warhead::UnitSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
+// Units handed out by the map unit index, checks see the same Player/Creature types as with the grid
+template<class Check>
+bool Warhead::UnitSearcher<Check>::VisitUnit(Unit* unit)
+{
+    // already found
+    if (i_object)
+        return false;
+
+    if (!unit->InSamePhase(i_phaseMask))
+        return true;
+
+    bool const accepted = unit->IsPlayer() ? i_check(unit->ToPlayer()) : i_check(unit->ToCreature());
+    if (accepted)
+        i_object = unit;
+
+    return !accepted;
+}
+
 template<class Check>
 void Warhead::UnitLastSearcher<Check>::Visit(CreatureMapType& m)
 {
@@ -409,6 +442,18 @@ void Warhead::UnitLastSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
+template<class Check>
+bool Warhead::UnitLastSearcher<Check>::VisitUnit(Unit* unit)
+{
+    if (!unit->InSamePhase(i_phaseMask))
+        return true;
+
+    if (unit->IsPlayer() ? i_check(unit->ToPlayer()) : i_check(unit->ToCreature()))
+        i_object = unit;
+
+    return true;
+}
+
 template<class Check>
 void Warhead::UnitListSearcher<Check>::Visit(PlayerMapType& m)
 {
@@ -427,6 +472,16 @@ void Warhead::UnitListSearcher<Check>::Visit(CreatureMapType& m)
                 Insert(itr->GetSource());
 }
 
+template<class Check>
+bool Warhead::UnitListSearcher<Check>::VisitUnit(Unit* unit)
+{
+    if (unit->InSamePhase(i_phaseMask))
+        if (unit->IsPlayer() ? i_check(unit->ToPlayer()) : i_check(unit->ToCreature()))
+            Insert(unit);
+
+    return true;
+}
+
 // Creature searchers
 
 template<class Check>
@@ -0,0 +1,150 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WARHEAD_VISIBILITY_DELTA_H
+#define WARHEAD_VISIBILITY_DELTA_H
+
+#include "Cell.h"
+#include "Position.h"
+#include <algorithm>
+
+// Changes a move of an observer can make to what it sees.
+// The cells reached from the old or the new position are visited, cells reached from neither
+// are skipped. An object keeps its visibility when it is well inside the visibility range at
+// both positions, or well outside at both, so only objects near the edge of the range need
+// the full visibility check. Objects whose client state doesn't match their side of the range
+// (e.g. hidden by stealth that ended since) are checked too, and objects at the client that
+// are not in any visited cell are left to a full update, see CoversClient.
+class VisibilityDelta
+{
+public:
+    enum CellChange : uint8
+    {
+        CELL_OUTSIDE,   // reached from neither position
+        CELL_ENTERED,   // reached from the new position only
+        CELL_LEFT,      // reached from the old position only
+        CELL_KEPT       // reached from both positions
+    };
+
+    enum RangeChange : uint8
+    {
+        RANGE_KEPT_INSIDE,  // well inside the range at both positions
+        RANGE_KEPT_OUTSIDE, // well outside the range at both positions
+        RANGE_MAY_CHANGE
+    };
+
+    // covers the stored visibility going stale in ways the margins do not measure, e.g. curved paths
+    static constexpr float SLACK = 2.0f;
+
+    // from: position of the last visibility update, to: current position
+    // radius: search radius, as passed to Cell::VisitAllObjects
+    VisibilityDelta(Position const& from, Position const& to, float radius) :
+        _from(from), _to(to), _radius(radius), _moved(from.GetExactDist(to))
+    {
+        CellCoord const low = Warhead::ComputeCellCoord(std::min(from.GetPositionX(), to.GetPositionX()) - radius, std::min(from.GetPositionY(), to.GetPositionY()) - radius).normalize();
+        CellCoord const high = Warhead::ComputeCellCoord(std::max(from.GetPositionX(), to.GetPositionX()) + radius, std::max(from.GetPositionY(), to.GetPositionY()) + radius).normalize();
+        _area = CellArea(low, high);
+    }
+
+    // bounding area of the cells reached from either position
+    [[nodiscard]] CellArea const& GetArea() const { return _area; }
+    [[nodiscard]] float GetMoveDistance() const { return _moved; }
+
+    [[nodiscard]] CellChange GetCellChange(CellCoord const& cell) const
+    {
+        bool const before = Reaches(_from, cell);
+        bool const after = Reaches(_to, cell);
+
+        if (before && after)
+            return CELL_KEPT;
+
+        if (after)
+            return CELL_ENTERED;
+
+        return before ? CELL_LEFT : CELL_OUTSIDE;
+    }
+
+    // Whether an object may have entered or left the visibility range because of the move.
+    // range: distance the object is visible at, object sizes included
+    // drift: how far the object may have moved since its visibility was last checked
+    [[nodiscard]] RangeChange GetRangeChange(Position const& target, float range, float drift) const
+    {
+        // the stored visibility was checked somewhere along the way, not exactly at the old position
+        float const margin = _moved + drift + SLACK;
+        float const before = _from.GetExactDistSq(target);
+        float const after = _to.GetExactDistSq(target);
+        float const rangeSq = range * range;
+
+        if (range > margin && before < (range - margin) * (range - margin) && after < rangeSq)
+            return RANGE_KEPT_INSIDE;
+
+        if (before >= (range + margin) * (range + margin) && after >= rangeSq)
+            return RANGE_KEPT_OUTSIDE;
+
+        return RANGE_MAY_CHANGE;
+    }
+
+    [[nodiscard]] bool MayChange(Position const& target, float range, float drift) const
+    {
+        return GetRangeChange(target, range, drift) == RANGE_MAY_CHANGE;
+    }
+
+    // Whether the visibility of an object has to be checked. atClient: the observer's client has the object.
+    // An object kept inside the range but missing at the client was hidden by more than the distance, e.g. by
+    // stealth or invisibility that ended without a visibility update, and is checked again. The same goes for
+    // an object kept outside the range that is still at the client.
+    [[nodiscard]] bool NeedsCheck(Position const& target, float range, float drift, bool atClient) const
+    {
+        switch (GetRangeChange(target, range, drift))
+        {
+            case RANGE_KEPT_INSIDE:
+                return !atClient;
+            case RANGE_KEPT_OUTSIDE:
+                return atClient;
+            default:
+                return true;
+        }
+    }
+
+    // Whether the visited cells held every object at the observer's client. clientObjectsFound: objects at the
+    // client the visit found, clientObjects: all of them. Objects which left the visited cells (teleports, long
+    // moves between two notifies) are only removed by the full update, which drops what it did not find.
+    [[nodiscard]] static bool CoversClient(std::size_t clientObjectsFound, std::size_t clientObjects)
+    {
+        return clientObjectsFound >= clientObjects;
+    }
+
+private:
+    [[nodiscard]] bool Reaches(Position const& pos, CellCoord const& cell) const
+    {
+        // cell n covers [(n - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL, (n - CENTER_GRID_CELL_ID + 1) * SIZE_OF_GRID_CELL)
+        float const lowX = (float(cell.x_coord) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL;
+        float const lowY = (float(cell.y_coord) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL;
+        float const dx = std::max({ lowX - pos.GetPositionX(), 0.0f, pos.GetPositionX() - lowX - SIZE_OF_GRID_CELL });
+        float const dy = std::max({ lowY - pos.GetPositionY(), 0.0f, pos.GetPositionY() - lowY - SIZE_OF_GRID_CELL });
+        return dx * dx + dy * dy <= _radius * _radius;
+    }
+
+    Position _from;
+    Position _to;
+    float _radius;
+    float _moved;
+    CellArea _area;
+};
+
+#endif
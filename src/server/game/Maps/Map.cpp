@@ -36,6 +36,7 @@
 #include "ObjectAccessor.h"
 #include "ScriptMgr.h"
 #include "Transport.h"
+#include "UnitSpatialIndex.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
 #include "Vehicle.h"
@@ -247,6 +248,9 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
 
+    if (CONF_GET_BOOL("Map.UnitSpatialIndex"))
+        _unitSpatialIndex = std::make_unique<UnitSpatialIndex>();
+
     sScriptMgr->OnCreateMap(this);
 }
 
@@ -864,6 +868,10 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         transport->Update(t_diff);
     }
 
+    // catch positions changed without a map relocation (transport passengers, direct Relocate calls)
+    if (_unitSpatialIndex)
+        _unitSpatialIndex->Refresh();
+
     SendObjectUpdates();
 
     ///- Process necessary scripts
@@ -889,6 +897,20 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (_visibilityDeltaChecked || _visibilityDeltaSkipped)
+    {
+        METRIC_VALUE("map_visibility_delta_checked", uint64(_visibilityDeltaChecked),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_visibility_delta_skipped", uint64(_visibilityDeltaSkipped),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        _visibilityDeltaChecked = 0;
+        _visibilityDeltaSkipped = 0;
+    }
 }
 
 void Map::HandleDelayedVisibility()
@@ -1028,6 +1050,9 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
 
     player->Relocate(x, y, z, o);
 
+    if (_unitSpatialIndex)
+        _unitSpatialIndex->Relocate(player);
+
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
 
@@ -1052,6 +1077,9 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
 
     creature->Relocate(x, y, z, o);
 
+    if (_unitSpatialIndex)
+        _unitSpatialIndex->Relocate(creature);
+
     if (creature->IsVehicle())
         creature->GetVehicleKit()->RelocatePassengers();
 
@@ -2782,8 +2810,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    SharedWorldPacket packet(data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(packet);
 }
 
 template<class T>
@@ -54,6 +54,7 @@ class MotionTransport;
 class PathGenerator;
 class GameObjectModel;
 class MapEntry;
+class UnitSpatialIndex;
 
 struct ScriptInfo;
 struct ScriptAction;
@@ -650,6 +651,16 @@ public:
         return _activeNonPlayers.size();
     }
 
+    // Packed unit positions used by unit searchers, nullptr when disabled
+    [[nodiscard]] UnitSpatialIndex* GetUnitSpatialIndex() const { return _unitSpatialIndex.get(); }
+
+    // Objects checked and skipped by delta visibility updates, reported as metrics every update
+    void AddVisibilityDeltaChecks(uint32 checked, uint32 skipped)
+    {
+        _visibilityDeltaChecked += checked;
+        _visibilityDeltaSkipped += skipped;
+    }
+
     virtual std::string GetDebugInfo() const;
 
 private:
@@ -671,6 +682,14 @@ private:
     void RemoveDynamicObjectFromMoveList(DynamicObject* go);
 
     std::vector<Creature*> _creaturesToMove;
+
+    // optional, see Map.UnitSpatialIndex
+    std::unique_ptr<UnitSpatialIndex> _unitSpatialIndex;
+
+    // see Visibility.Delta
+    uint32 _visibilityDeltaChecked{};
+    uint32 _visibilityDeltaSkipped{};
+
     std::vector<GameObject*> _gameObjectsToMove;
     std::vector<DynamicObject*> _dynamicObjectsToMove;
 
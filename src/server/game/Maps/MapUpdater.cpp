@@ -23,6 +23,7 @@
 #include "LFGMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include "WorldSession.h"
 
 class UpdateRequest
 {
@@ -69,6 +70,29 @@ private:
     uint32 _diff;
 };
 
+class SessionsUpdateRequest : public UpdateRequest
+{
+public:
+    SessionsUpdateRequest(MapUpdater& u, WorldSession* const* sessions, std::size_t count, std::atomic<uint32>& processedPackets) :
+        _updater(u), _sessions(sessions), _count(count), _processedPackets(processedPackets) { }
+
+    void UpdateMap() override
+    {
+        uint32 processedPackets = 0;
+        for (std::size_t i = 0; i < _count; ++i)
+            processedPackets += _sessions[i]->ProcessReadOnlyPackets();
+
+        _processedPackets.fetch_add(processedPackets, std::memory_order_relaxed);
+        _updater.FinishUpdate();
+    }
+
+private:
+    MapUpdater& _updater;
+    WorldSession* const* _sessions;
+    std::size_t _count;
+    std::atomic<uint32>& _processedPackets;
+};
+
 void MapUpdater::InitThreads(std::size_t num_threads)
 {
     _workerThreads.reserve(num_threads);
@@ -113,6 +137,19 @@ void MapUpdater::ScheduleLfgUpdate(uint32 diff)
     _queue.Push(new LFGUpdateRequest(*this, diff));
 }
 
+void MapUpdater::ScheduleSessionsUpdate(std::vector<WorldSession*> const& sessions, std::atomic<uint32>& processedPackets)
+{
+    // a few batches per thread so a handful of busy sessions do not leave the other threads idle
+    std::size_t batchSize = std::max<std::size_t>(sessions.size() / (_workerThreads.size() * 4) + 1, 16);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (std::size_t i = 0; i < sessions.size(); i += batchSize)
+    {
+        ++pending_requests;
+        _queue.Push(new SessionsUpdateRequest(*this, sessions.data() + i, std::min(batchSize, sessions.size() - i), processedPackets));
+    }
+}
+
 bool MapUpdater::IsActive()
 {
     return !_workerThreads.empty();
@@ -20,10 +20,13 @@
 
 #include "Define.h"
 #include "PCQueue.h"
+#include <atomic>
 #include <thread>
+#include <vector>
 
 class Map;
 class UpdateRequest;
+class WorldSession;
 
 class WH_GAME_API MapUpdater
 {
@@ -33,6 +36,7 @@ public:
 
     void ScheduleUpdate(Map& map, uint32 diff, uint32 s_diff);
     void ScheduleLfgUpdate(uint32 diff);
+    void ScheduleSessionsUpdate(std::vector<WorldSession*> const& sessions, std::atomic<uint32>& processedPackets);
     void WaitThreads();
     void InitThreads(std::size_t num_threads);
     void Stop();
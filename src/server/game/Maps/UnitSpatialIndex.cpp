@@ -0,0 +1,92 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "UnitSpatialIndex.h"
+#include "Errors.h"
+#include "Unit.h"
+
+void UnitSpatialIndex::Insert(Unit* unit)
+{
+    ASSERT(!unit->m_spatialIndexSlot.Index);
+    Link(unit);
+}
+
+void UnitSpatialIndex::Remove(Unit* unit)
+{
+    if (unit->m_spatialIndexSlot.Index != this)
+        return;
+
+    Unlink(unit);
+}
+
+void UnitSpatialIndex::Relocate(Unit* unit)
+{
+    UnitSpatialIndexSlot const& slot = unit->m_spatialIndexSlot;
+    if (slot.Index != this)
+        return;
+
+    if (SpatialCellIndex<Unit*>::GetCellId(unit->GetPositionX(), unit->GetPositionY()) != slot.CellId)
+    {
+        Unlink(unit);
+        Link(unit);
+        return;
+    }
+
+    _cells.Update({ slot.CellId, slot.Position }, unit->GetPositionX(), unit->GetPositionY(), unit->GetCombatReach());
+}
+
+void UnitSpatialIndex::Refresh()
+{
+    _moved.clear();
+
+    _cells.VisitAll([this](Unit* unit)
+    {
+        UnitSpatialIndexSlot const& slot = unit->m_spatialIndexSlot;
+        if (SpatialCellIndex<Unit*>::GetCellId(unit->GetPositionX(), unit->GetPositionY()) != slot.CellId)
+            _moved.push_back(unit);
+        else
+            _cells.Update({ slot.CellId, slot.Position }, unit->GetPositionX(), unit->GetPositionY(), unit->GetCombatReach());
+    });
+
+    // units which changed their cell, relinked after the walk which must not modify the index
+    for (Unit* unit : _moved)
+    {
+        Unlink(unit);
+        Link(unit);
+    }
+}
+
+void UnitSpatialIndex::Link(Unit* unit)
+{
+    auto const slot = _cells.Insert(unit, unit->GetPositionX(), unit->GetPositionY(), unit->GetCombatReach());
+    unit->m_spatialIndexSlot = { this, slot.CellId, slot.Position };
+}
+
+void UnitSpatialIndex::Unlink(Unit* unit)
+{
+    UnitSpatialIndexSlot& slot = unit->m_spatialIndexSlot;
+
+    // the last unit of the bucket takes the freed position
+    if (Unit** moved = _cells.Remove({ slot.CellId, slot.Position }))
+        (*moved)->m_spatialIndexSlot.Position = slot.Position;
+
+    slot = {};
+}
@@ -0,0 +1,271 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _UNIT_SPATIAL_INDEX_H_
+#define _UNIT_SPATIAL_INDEX_H_
+
+#include "Define.h"
+#include "Errors.h"
+#include "GridDefines.h"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <unordered_map>
+#include <vector>
+
+class Unit;
+class UnitSpatialIndex;
+
+// Position of a unit inside its map index, owned by the unit
+struct UnitSpatialIndexSlot
+{
+    UnitSpatialIndex* Index{ nullptr };
+    uint32 CellId{ 0 };
+    uint32 Position{ 0 };
+};
+
+namespace Warhead
+{
+    // Searchers which can be fed straight from the index instead of the grid containers.
+    // VisitUnit returns false once the searcher does not want more units.
+    template<class T>
+    concept IndexedUnitVisitor = requires(T& visitor, Unit* unit)
+    {
+        { visitor.VisitUnit(unit) } -> std::same_as<bool>;
+    };
+}
+
+/// Positions bucketed by grid cell, the storage behind UnitSpatialIndex.
+/// Positions and combat reach are stored as plain float arrays so range queries
+/// can discard far away entries with a tight, vectorizable loop before any entry is touched.
+/// Entries are addressed by the slot returned on insertion; removal moves the last entry
+/// of the bucket into the freed position.
+template<typename T>
+class SpatialCellIndex
+{
+public:
+    struct Slot
+    {
+        uint32 CellId{ 0 };
+        uint32 Position{ 0 };
+    };
+
+    [[nodiscard]] std::size_t Size() const { return _size; }
+
+    static uint32 GetCellId(float x, float y)
+    {
+        return Warhead::ComputeCellCoord(x, y).normalize().GetId();
+    }
+
+    Slot Insert(T value, float x, float y, float reach)
+    {
+        uint32 const cellId = GetCellId(x, y);
+        Bucket& bucket = _buckets[cellId];
+
+        bucket.X.push_back(x);
+        bucket.Y.push_back(y);
+        bucket.Reach.push_back(reach);
+        bucket.Values.push_back(value);
+        ++_size;
+
+        // only grows, a stale maximum just widens the searched cell area
+        _maxReach = std::max(_maxReach, reach);
+        return { cellId, uint32(bucket.Values.size() - 1) };
+    }
+
+    /// Removes the entry at slot. Returns the entry moved into its position, which needs its slot updated, if any.
+    T* Remove(Slot const& slot)
+    {
+        auto itr = _buckets.find(slot.CellId);
+        ASSERT(itr != _buckets.end());
+
+        Bucket& bucket = itr->second;
+        uint32 const last = uint32(bucket.Values.size() - 1);
+        T* moved = nullptr;
+
+        if (slot.Position != last)
+        {
+            bucket.X[slot.Position] = bucket.X[last];
+            bucket.Y[slot.Position] = bucket.Y[last];
+            bucket.Reach[slot.Position] = bucket.Reach[last];
+            bucket.Values[slot.Position] = bucket.Values[last];
+            moved = &bucket.Values[slot.Position];
+        }
+
+        bucket.X.pop_back();
+        bucket.Y.pop_back();
+        bucket.Reach.pop_back();
+        bucket.Values.pop_back();
+        --_size;
+
+        if (bucket.Values.empty())
+        {
+            _buckets.erase(itr);
+            moved = nullptr;
+        }
+
+        return moved;
+    }
+
+    /// Updates the position of an entry which stays in its cell
+    void Update(Slot const& slot, float x, float y, float reach)
+    {
+        Bucket& bucket = _buckets.at(slot.CellId);
+        bucket.X[slot.Position] = x;
+        bucket.Y[slot.Position] = y;
+        bucket.Reach[slot.Position] = reach;
+        _maxReach = std::max(_maxReach, reach);
+    }
+
+    /// Calls visitor(T const&) for every entry, in no particular order
+    template<typename Visitor>
+    void VisitAll(Visitor&& visitor) const
+    {
+        for (auto const& [cellId, bucket] : _buckets)
+            for (T const& value : bucket.Values)
+                visitor(value);
+    }
+
+    /// Calls visitor(T const&) for every entry which may be within radius of x, y (including its combat reach).
+    /// Visiting stops when the visitor returns false. The visitor must not modify the index.
+    template<typename Visitor>
+    void Visit(float x, float y, float radius, Visitor&& visitor) const
+    {
+        if (!_size)
+            return;
+
+        radius = std::min<float>(radius, SIZE_OF_GRIDS);
+
+        // buckets are picked with the largest reach in the index, each entry is then tested with its own
+        float const cellRadius = radius + _maxReach;
+        uint32 const lowX = ComputeCell(x - cellRadius);
+        uint32 const highX = ComputeCell(x + cellRadius);
+        uint32 const lowY = ComputeCell(y - cellRadius);
+        uint32 const highY = ComputeCell(y + cellRadius);
+
+        for (uint32 cellX = lowX; cellX <= highX; ++cellX)
+        {
+            for (uint32 cellY = lowY; cellY <= highY; ++cellY)
+            {
+                auto itr = _buckets.find(CellCoord(cellX, cellY).GetId());
+                if (itr == _buckets.end())
+                    continue;
+
+                if (!VisitBucket(itr->second, x, y, radius, visitor))
+                    return;
+            }
+        }
+    }
+
+private:
+    struct Bucket
+    {
+        std::vector<float> X;
+        std::vector<float> Y;
+        std::vector<float> Reach;
+        std::vector<T> Values;
+    };
+
+    static constexpr std::size_t BATCH_SIZE = 64;
+
+    static uint32 ComputeCell(float coord)
+    {
+        double const offset = (double(coord) - CENTER_GRID_CELL_OFFSET) / SIZE_OF_GRID_CELL;
+        return uint32(std::clamp(int32(offset + CENTER_GRID_CELL_ID + 0.5f), 0, int32(TOTAL_NUMBER_OF_CELLS_PER_MAP) - 1));
+    }
+
+    template<typename Visitor>
+    static bool VisitBucket(Bucket const& bucket, float x, float y, float radius, Visitor& visitor)
+    {
+        std::size_t const count = bucket.Values.size();
+        float const* posX = bucket.X.data();
+        float const* posY = bucket.Y.data();
+        float const* reach = bucket.Reach.data();
+
+        for (std::size_t base = 0; base < count; base += BATCH_SIZE)
+        {
+            std::size_t const batch = std::min(BATCH_SIZE, count - base);
+
+            // branchless distance filter, collects a hit mask for the batch
+            uint64 hits = 0;
+            for (std::size_t i = 0; i < batch; ++i)
+            {
+                float const dx = posX[base + i] - x;
+                float const dy = posY[base + i] - y;
+                float const range = radius + reach[base + i];
+                hits |= uint64(dx * dx + dy * dy <= range * range) << i;
+            }
+
+            while (hits)
+            {
+                std::size_t const i = std::countr_zero(hits);
+                hits &= hits - 1;
+
+                if (!visitor(bucket.Values[base + i]))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::unordered_map<uint32 /*cellId*/, Bucket> _buckets;
+    std::size_t _size{ 0 };
+    float _maxReach{ 0.0f };
+};
+
+/// Packed per map index of all units in world, see SpatialCellIndex.
+/// Positions are refreshed on map relocation and once per map update, which catches
+/// positions changed without a relocation (transport passengers, direct Relocate calls).
+class WH_GAME_API UnitSpatialIndex
+{
+public:
+    // distance a unit may have moved since its indexed position was refreshed
+    static constexpr float POSITION_SLACK = 5.0f;
+
+    UnitSpatialIndex() = default;
+
+    UnitSpatialIndex(UnitSpatialIndex const&) = delete;
+    UnitSpatialIndex& operator=(UnitSpatialIndex const&) = delete;
+
+    void Insert(Unit* unit);
+    void Remove(Unit* unit);
+    void Relocate(Unit* unit);
+
+    /// Refreshes the positions of all units
+    void Refresh();
+
+    [[nodiscard]] std::size_t Size() const { return _cells.Size(); }
+
+    /// Calls visitor(Unit*) for every unit which may be within radius of x, y (including its combat reach).
+    /// Visiting stops when the visitor returns false. The visitor must not add, remove or relocate units.
+    template<typename Visitor>
+    void Visit(float x, float y, float radius, Visitor&& visitor) const
+    {
+        _cells.Visit(x, y, radius + POSITION_SLACK, [&visitor](Unit* unit) { return visitor(unit); });
+    }
+
+private:
+    void Link(Unit* unit);
+    void Unlink(Unit* unit);
+
+    SpatialCellIndex<Unit*> _cells;
+    std::vector<Unit*> _moved;
+};
+
+#endif
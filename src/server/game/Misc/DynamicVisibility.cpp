@@ -21,11 +21,19 @@
 #include "DynamicVisibility.h"
 
 uint8 DynamicVisibilityMgr::visibilitySettingsIndex = 0;
+uint32 DynamicVisibilityMgr::adjustTimer = 0;
 
-void DynamicVisibilityMgr::Update(uint32 sessionCount)
+void DynamicVisibilityMgr::Update(uint32 diff, uint32 averageUpdateTime)
 {
-    if (sessionCount >= (visibilitySettingsIndex + 1) * ((uint32)VISIBILITY_SETTINGS_PLAYER_INTERVAL) && visibilitySettingsIndex < VISIBILITY_SETTINGS_MAX_INTERVAL_NUM - 1)
+    // move at most one level per interval, the average needs time to reflect the previous change
+    adjustTimer += diff;
+    if (adjustTimer < VISIBILITY_SETTINGS_ADJUST_INTERVAL)
+        return;
+
+    adjustTimer = 0;
+
+    if (averageUpdateTime > VISIBILITY_SETTINGS_RAISE_UPDATE_TIME && visibilitySettingsIndex < VISIBILITY_SETTINGS_MAX_INTERVAL_NUM - 1)
         ++visibilitySettingsIndex;
-    else if (visibilitySettingsIndex && sessionCount < visibilitySettingsIndex * ((uint32)VISIBILITY_SETTINGS_PLAYER_INTERVAL) - 100)
+    else if (averageUpdateTime < VISIBILITY_SETTINGS_LOWER_UPDATE_TIME && visibilitySettingsIndex)
         --visibilitySettingsIndex;
 }
@@ -28,11 +28,16 @@ struct VisibilitySettingData
 };
 
 // pussywizard: dynamic visibility settings
-// 7 player intervals: 0-499, 500-999, 1000-1499, 1500-1999, 2000-2499, 2500-2999, 3000+
+// 7 load levels, from an idle server (0) to an overloaded one (6), originally sized for 500 players per level
 // 5 map types: common, instance, raid, bg, arena
 // feel free to add more intervals, change existing ones or move to conf file :P
-#define VISIBILITY_SETTINGS_PLAYER_INTERVAL 500
 #define VISIBILITY_SETTINGS_MAX_INTERVAL_NUM 7
+
+// The level follows the measured world update time instead of the session count,
+// a busy server with few players backs off just like a crowded one
+#define VISIBILITY_SETTINGS_ADJUST_INTERVAL 5000    // ms between level changes
+#define VISIBILITY_SETTINGS_RAISE_UPDATE_TIME 75    // average world update time (ms) above which notifies get sparser
+#define VISIBILITY_SETTINGS_LOWER_UPDATE_TIME 40    // average world update time (ms) below which notifies get denser
 const VisibilitySettingData VisibilitySettings[VISIBILITY_SETTINGS_MAX_INTERVAL_NUM][5] =
 {
     { {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f} }, // 0-499
@@ -47,12 +52,14 @@ const VisibilitySettingData VisibilitySettings[VISIBILITY_SETTINGS_MAX_INTERVAL_
 class DynamicVisibilityMgr
 {
 public:
-    static void Update(uint32 sessionCount);
+    static void Update(uint32 diff, uint32 averageUpdateTime);
+    static uint8 GetLevel() { return visibilitySettingsIndex; }
     static uint32 GetVisibilityNotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].visibilityNotifyDelay; }
     static uint32 GetAINotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].aiNotifyDelay; }
     static float GetReqMoveDistSq(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].requiredMoveDistanceSq; }
 protected:
     static uint8 visibilitySettingsIndex;
+    static uint32 adjustTimer;
 };
 
 #endif
@@ -0,0 +1,213 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "OpcodeProfiler.h"
+#include "GameConfig.h"
+#include "Log.h"
+#include "Metric.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+// Number of opcodes sent to the metrics on every metric update
+#define OPCODE_PROFILER_METRIC_OPCODES 10
+
+OpcodeProfiler* OpcodeProfiler::instance()
+{
+    static OpcodeProfiler instance;
+    return &instance;
+}
+
+void OpcodeProfiler::LoadFromConfig()
+{
+    _enabled.store(CONF_GET_BOOL("OpcodeProfiler.Enable"), std::memory_order_relaxed);
+    _slowThreshold.store(uint64(CONF_GET_UINT("OpcodeProfiler.SlowThreshold")) * IN_MILLISECONDS, std::memory_order_relaxed);
+    _slowLogSampleRate.store(std::max<uint32>(CONF_GET_UINT("OpcodeProfiler.SlowLogSampleRate"), 1), std::memory_order_relaxed);
+}
+
+OpcodeProfiler::ThreadCounters& OpcodeProfiler::GetThreadCounters()
+{
+    thread_local ThreadCounters* counters = nullptr;
+    if (!counters)
+    {
+        // owned by the profiler, so the counters of finished threads stay in the profile
+        std::lock_guard<std::mutex> lock(_threadsLock);
+        counters = _threads.emplace_back(std::make_unique<ThreadCounters>()).get();
+    }
+
+    return *counters;
+}
+
+void OpcodeProfiler::Record(OpcodeClient opcode, std::size_t bytes, Microseconds elapsed, WorldSession const* session)
+{
+    ThreadCounters& threadCounters = GetThreadCounters();
+
+    if (threadCounters.ResetRequested.load(std::memory_order_acquire))
+    {
+        for (Counters& counters : threadCounters.Opcodes)
+        {
+            counters.Calls.store(0, std::memory_order_relaxed);
+            counters.TotalTime.store(0, std::memory_order_relaxed);
+            counters.MaxTime.store(0, std::memory_order_relaxed);
+            counters.Bytes.store(0, std::memory_order_relaxed);
+            counters.SlowCalls.store(0, std::memory_order_relaxed);
+            counters.IntervalMaxTime.store(0, std::memory_order_relaxed);
+        }
+
+        threadCounters.ResetRequested.store(false, std::memory_order_release);
+    }
+
+    // only this thread writes its counters, plain load and store instead of read-modify-write
+    Counters& counters = threadCounters.Opcodes[opcode];
+    uint64 time = uint64(std::max<int64>(elapsed.count(), 0));
+
+    counters.Calls.store(counters.Calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    counters.TotalTime.store(counters.TotalTime.load(std::memory_order_relaxed) + time, std::memory_order_relaxed);
+    counters.Bytes.store(counters.Bytes.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+
+    if (time > counters.MaxTime.load(std::memory_order_relaxed))
+        counters.MaxTime.store(time, std::memory_order_relaxed);
+
+    // LogMetrics clears the interval maximum from its own thread, so this one needs a compare exchange
+    uint64 intervalMax = counters.IntervalMaxTime.load(std::memory_order_relaxed);
+    while (time > intervalMax && !counters.IntervalMaxTime.compare_exchange_weak(intervalMax, time, std::memory_order_relaxed))
+        ;
+
+    uint64 slowThreshold = _slowThreshold.load(std::memory_order_relaxed);
+    if (!slowThreshold || time < slowThreshold)
+        return;
+
+    uint64 slowCalls = counters.SlowCalls.load(std::memory_order_relaxed) + 1;
+    counters.SlowCalls.store(slowCalls, std::memory_order_relaxed);
+
+    if (slowCalls % _slowLogSampleRate.load(std::memory_order_relaxed))
+        return;
+
+    LOG_WARN("network.opcode.slow", "Handler of {} took {}us for {} bytes from {} (slow call {} of this opcode on this thread)",
+        GetOpcodeNameForLogging(opcode), time, bytes, session->GetPlayerInfo(), slowCalls);
+}
+
+std::vector<OpcodeProfileEntry> OpcodeProfiler::GetProfile() const
+{
+    std::vector<OpcodeProfileEntry> profile(NUM_OPCODE_HANDLERS);
+
+    {
+        std::lock_guard<std::mutex> lock(_threadsLock);
+        for (std::unique_ptr<ThreadCounters> const& threadCounters : _threads)
+        {
+            // not cleared yet by its thread, which has not handled a packet since the reset
+            if (threadCounters->ResetRequested.load(std::memory_order_acquire))
+                continue;
+
+            for (std::size_t i = 0; i < NUM_OPCODE_HANDLERS; ++i)
+            {
+                Counters const& counters = threadCounters->Opcodes[i];
+                OpcodeProfileEntry& entry = profile[i];
+                entry.Calls += counters.Calls.load(std::memory_order_relaxed);
+                entry.TotalTime += counters.TotalTime.load(std::memory_order_relaxed);
+                entry.MaxTime = std::max(entry.MaxTime, counters.MaxTime.load(std::memory_order_relaxed));
+                entry.Bytes += counters.Bytes.load(std::memory_order_relaxed);
+                entry.SlowCalls += counters.SlowCalls.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < NUM_OPCODE_HANDLERS; ++i)
+        profile[i].Opcode = OpcodeClient(i);
+
+    profile.erase(std::remove_if(profile.begin(), profile.end(), [](OpcodeProfileEntry const& entry) { return !entry.Calls; }), profile.end());
+
+    std::sort(profile.begin(), profile.end(), [](OpcodeProfileEntry const& left, OpcodeProfileEntry const& right)
+    {
+        return left.TotalTime > right.TotalTime;
+    });
+
+    return profile;
+}
+
+void OpcodeProfiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    for (std::unique_ptr<ThreadCounters> const& threadCounters : _threads)
+        threadCounters->ResetRequested.store(true, std::memory_order_release);
+}
+
+std::vector<uint64> OpcodeProfiler::TakeIntervalMaxTimes()
+{
+    std::vector<uint64> maxTimes(NUM_OPCODE_HANDLERS, 0);
+
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    for (std::unique_ptr<ThreadCounters> const& threadCounters : _threads)
+        for (std::size_t i = 0; i < NUM_OPCODE_HANDLERS; ++i)
+            maxTimes[i] = std::max(maxTimes[i], threadCounters->Opcodes[i].IntervalMaxTime.exchange(0, std::memory_order_relaxed));
+
+    return maxTimes;
+}
+
+void OpcodeProfiler::LogMetrics()
+{
+    if (!IsEnabled())
+        return;
+
+    std::vector<OpcodeProfileEntry> profile = GetProfile();
+    std::vector<uint64> maxTimes = TakeIntervalMaxTimes();
+
+    std::lock_guard<std::mutex> lock(_metricsLock);
+
+    if (_lastMetrics.size() != NUM_OPCODE_HANDLERS)
+        _lastMetrics.assign(NUM_OPCODE_HANDLERS, OpcodeProfileEntry());
+
+    // turn the totals into the amounts since the previous update, a reset starts over from zero
+    std::vector<OpcodeProfileEntry> deltas;
+    for (OpcodeProfileEntry const& entry : profile)
+    {
+        OpcodeProfileEntry& last = _lastMetrics[entry.Opcode];
+        OpcodeProfileEntry delta = entry;
+
+        if (entry.Calls >= last.Calls && entry.TotalTime >= last.TotalTime && entry.Bytes >= last.Bytes)
+        {
+            delta.Calls -= last.Calls;
+            delta.TotalTime -= last.TotalTime;
+            delta.Bytes -= last.Bytes;
+        }
+
+        delta.MaxTime = maxTimes[entry.Opcode];
+
+        last = entry;
+
+        if (delta.Calls)
+            deltas.push_back(delta);
+    }
+
+    std::size_t count = std::min<std::size_t>(deltas.size(), OPCODE_PROFILER_METRIC_OPCODES);
+    std::partial_sort(deltas.begin(), deltas.begin() + count, deltas.end(), [](OpcodeProfileEntry const& left, OpcodeProfileEntry const& right)
+    {
+        return left.TotalTime > right.TotalTime;
+    });
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::string opcodeName = opcodeTable[deltas[i].Opcode]->Name;
+        METRIC_VALUE("opcode_handler_time", deltas[i].TotalTime, METRIC_TAG("opcode", opcodeName));
+        METRIC_VALUE("opcode_handler_calls", deltas[i].Calls, METRIC_TAG("opcode", opcodeName));
+        METRIC_VALUE("opcode_handler_bytes", deltas[i].Bytes, METRIC_TAG("opcode", opcodeName));
+        METRIC_VALUE("opcode_handler_max_time", deltas[i].MaxTime, METRIC_TAG("opcode", opcodeName));
+    }
+}
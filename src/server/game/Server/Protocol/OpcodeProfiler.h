@@ -0,0 +1,102 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WARHEAD_OPCODE_PROFILER_H
+#define WARHEAD_OPCODE_PROFILER_H
+
+#include "Common.h"
+#include "Duration.h"
+#include "Opcodes.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class WorldSession;
+
+struct OpcodeProfileEntry
+{
+    OpcodeClient Opcode = OpcodeClient(NULL_OPCODE);
+    uint64 Calls = 0;
+    uint64 TotalTime = 0;                                   // microseconds
+    uint64 MaxTime = 0;                                     // microseconds
+    uint64 Bytes = 0;
+    uint64 SlowCalls = 0;
+};
+
+/// Per opcode handler timings. Counters are kept per thread and only summed up when read,
+/// so recording never contends with other threads. Disabled, it costs one relaxed load per packet.
+class WH_GAME_API OpcodeProfiler
+{
+public:
+    static OpcodeProfiler* instance();
+
+    void LoadFromConfig();
+
+    bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    void Record(OpcodeClient opcode, std::size_t bytes, Microseconds elapsed, WorldSession const* session);
+
+    /// Sums the counters of all threads, sorted by total time
+    std::vector<OpcodeProfileEntry> GetProfile() const;
+
+    void Reset();
+
+    /// Sends calls, time, bytes and longest call since the previous call for the most expensive opcodes
+    void LogMetrics();
+
+private:
+    OpcodeProfiler() = default;
+
+    struct Counters
+    {
+        std::atomic<uint64> Calls{ 0 };
+        std::atomic<uint64> TotalTime{ 0 };
+        std::atomic<uint64> MaxTime{ 0 };
+        std::atomic<uint64> Bytes{ 0 };
+        std::atomic<uint64> SlowCalls{ 0 };
+        std::atomic<uint64> IntervalMaxTime{ 0 };           // microseconds, taken and cleared by LogMetrics
+    };
+
+    /// Written by its thread only, other threads only read it
+    struct ThreadCounters
+    {
+        std::array<Counters, NUM_OPCODE_HANDLERS> Opcodes;
+        std::atomic<bool> ResetRequested{ false };
+    };
+
+    ThreadCounters& GetThreadCounters();
+
+    /// Longest call of every opcode on all threads since the previous call
+    std::vector<uint64> TakeIntervalMaxTimes();
+
+    std::atomic<bool> _enabled{ false };
+    std::atomic<uint64> _slowThreshold{ 0 };                // microseconds, 0 disables the slow handler log
+    std::atomic<uint32> _slowLogSampleRate{ 1 };
+
+    mutable std::mutex _threadsLock;
+    std::vector<std::unique_ptr<ThreadCounters>> _threads;
+
+    std::mutex _metricsLock;
+    std::vector<OpcodeProfileEntry> _lastMetrics;
+};
+
+#define sOpcodeProfiler OpcodeProfiler::instance()
+
+#endif
@@ -22,6 +22,8 @@
 #include "Common.h"
 #include "Duration.h"
 #include "Opcodes.h"
+#include <atomic>
+#include <memory>
 
 class WorldPacket : public ByteBuffer
 {
@@ -78,9 +80,36 @@ public:
 
     [[nodiscard]] TimePoint GetReceivedTime() const { return m_receivedTime; }
 
+    std::atomic<WorldPacket*> QueueLink{ nullptr }; // WorldSession receive queue, never copied
+
 protected:
     uint16 m_opcode{NULL_OPCODE};
     TimePoint m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
 
+/// Packet sent to many sessions: the first receiver makes one immutable copy that every other receiver shares
+class SharedWorldPacket
+{
+public:
+    explicit SharedWorldPacket(WorldPacket const* packet) : _packet(packet) { }
+
+    SharedWorldPacket(SharedWorldPacket const&) = delete;
+    SharedWorldPacket& operator=(SharedWorldPacket const&) = delete;
+
+    [[nodiscard]] WorldPacket const* GetPacket() const { return _packet; }
+    [[nodiscard]] bool IsShared() const { return _shared != nullptr; }
+
+    std::shared_ptr<WorldPacket const> const& Share()
+    {
+        if (!_shared)
+            _shared = std::make_shared<WorldPacket const>(*_packet);
+
+        return _shared;
+    }
+
+private:
+    WorldPacket const* _packet;
+    std::shared_ptr<WorldPacket const> _shared;
+};
+
 #endif
@@ -42,6 +42,7 @@
 #include "Metric.h"
 #include "MuteMgr.h"
 #include "ObjectAccessor.h"
+#include "OpcodeProfiler.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PacketUtilities.h"
@@ -77,7 +78,7 @@ bool MapSessionFilter::Process(WorldPacket* packet)
         return true;
 
     //we do not process thread-unsafe packets
-    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
+    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE || opHandle->ProcessingPlace == PROCESS_THREADUNSAFE_READONLY)
         return false;
 
     Player* player = m_pSession->GetPlayer();
@@ -99,7 +100,7 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
         return true;
 
     //thread-unsafe packets should be processed in World::UpdateSessions()
-    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
+    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE || opHandle->ProcessingPlace == PROCESS_THREADUNSAFE_READONLY)
         return true;
 
     //no player attached? -> our client! ^^
@@ -111,6 +112,19 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return !player->IsInWorld();
 }
 
+//only read-only thread-unsafe packets, World::UpdateSessions() runs these on the map update threads
+bool ParallelSessionFilter::Process(WorldPacket* packet)
+{
+    ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
+    return opHandle->ProcessingPlace == PROCESS_THREADUNSAFE_READONLY;
+}
+
+uint32 WorldSession::ProcessReadOnlyPackets()
+{
+    ParallelSessionFilter updater(this);
+    return ProcessPackets(updater);
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldSocket> sock, AccountTypes sec, uint8 expansion, LocaleConstant locale, uint32 recruiter, bool isARecruiter, bool skipQueue, uint32 TotalTime) :
     m_timeOutTime(0),
@@ -179,7 +193,7 @@ WorldSession::~WorldSession()
 
     ///- empty incoming packet queue
     WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    while (_recvQueue.Dequeue(packet))
         delete packet;
 
     AuthDatabase.Execute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -213,16 +227,37 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
 }
 
 /// Send a packet to the client
+std::atomic<uint64> WorldSession::_sharedPacketBytesSaved(0);
+
 void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!CanSendPacket(packet))
+        return;
+
+    m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(SharedWorldPacket& packet)
+{
+    if (!CanSendPacket(packet.GetPacket()))
+        return;
+
+    if (packet.IsShared())
+        _sharedPacketBytesSaved.fetch_add(packet.GetPacket()->size(), std::memory_order_relaxed);
+
+    m_Socket->SendPacket(packet.Share());
+}
+
+bool WorldSession::CanSendPacket(WorldPacket const* packet)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         LOG_ERROR("network.opcode", "{} send NULL_OPCODE", GetPlayerInfo());
-        return;
+        return false;
     }
 
     if (!m_Socket)
-        return;
+        return false;
 
 #if defined(ENABLE_EXTRAS) && defined(ENABLE_EXTRA_LOGS) && defined(WARHEAD_DEBUG)
     // Code for network use statistic
@@ -261,18 +296,16 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 #endif                                                      // !WARHEAD_DEBUG
 
     if (!sScriptMgr->CanPacketSend(this, *packet))
-    {
-        return;
-    }
+        return false;
 
     LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
-    m_Socket->SendPacket(*packet);
+    return true;
 }
 
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
 }
 
 /// Logging helper for unexpected opcodes
@@ -294,21 +327,24 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
     packet->print_storage();
 }
 
-/// Update the WorldSession (triggered by World update)
-bool WorldSession::Update(uint32 diff, PacketFilter& updater)
+/// Calls the handler of the packet, timed by the opcode profiler when it is enabled
+void WorldSession::CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet)
 {
-    ///- Before we process anything:
-    /// If necessary, kick the player because the client didn't send anything for too long
-    /// (or they've been idling in character select)
-    if (CONF_GET_BOOL("CloseIdleConnections") && IsConnectionIdle() && m_Socket)
-        m_Socket->CloseSocket();
-
-    if (updater.ProcessUnsafe())
-        UpdateTimeOutTime(diff);
+    if (!sOpcodeProfiler->IsEnabled())
+    {
+        opHandle->Call(this, packet);
+        return;
+    }
 
-    HandleTeleportTimeout(updater.ProcessUnsafe());
+    TimePoint start = std::chrono::steady_clock::now();
+    opHandle->Call(this, packet);
+    sOpcodeProfiler->Record(static_cast<OpcodeClient>(packet.GetOpcode()), packet.size(),
+        std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start), this);
+}
 
-    ///- Retrieve packets from the receive queue and call the appropriate handlers
+/// Runs the handlers of the queued packets the filter accepts, stops at the first one it does not
+uint32 WorldSession::ProcessPackets(PacketFilter& updater)
+{
     /// not process packets if socket already closed
     WorldPacket* packet = nullptr;
 
@@ -317,12 +353,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     std::vector<WorldPacket*> requeuePackets;
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime().count();
-    auto queueSize{ _recvQueue.size() };
 
-    if (queueSize >= MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
-        LOG_WARN("network", "Found potential packet flood from: {}. Queue size: {}", GetPlayerInfo(), queueSize);
-
-    while (m_Socket && _recvQueue.next(packet, updater))
+    while (m_Socket && _recvQueue.Dequeue(packet, updater))
     {
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
@@ -357,7 +389,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                             break;
                         }
 
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                         LogUnprocessedTail(packet);
                     }
                     else
@@ -378,7 +410,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     if (!sScriptMgr->CanPacketReceive(this, *packet))
                         break;
 
-                    opHandle->Call(this, *packet);
+                    CallOpcodeHandler(opHandle, *packet);
                     LogUnprocessedTail(packet);
                 }
                 else
@@ -392,7 +424,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         break;
                     }
 
-                    opHandle->Call(this, *packet);
+                    CallOpcodeHandler(opHandle, *packet);
                     LogUnprocessedTail(packet);
                 }
                 else
@@ -414,7 +446,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         break;
                     }
 
-                    opHandle->Call(this, *packet);
+                    CallOpcodeHandler(opHandle, *packet);
                     LogUnprocessedTail(packet);
                 }
                 else
@@ -476,7 +508,33 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             break;
     }
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvQueue.Requeue(requeuePackets.begin(), requeuePackets.end());
+
+    return processedPackets;
+}
+
+/// Update the WorldSession (triggered by World update)
+bool WorldSession::Update(uint32 diff, PacketFilter& updater)
+{
+    ///- Before we process anything:
+    /// If necessary, kick the player because the client didn't send anything for too long
+    /// (or they've been idling in character select)
+    if (CONF_GET_BOOL("CloseIdleConnections") && IsConnectionIdle() && m_Socket)
+        m_Socket->CloseSocket();
+
+    if (updater.ProcessUnsafe())
+        UpdateTimeOutTime(diff);
+
+    HandleTeleportTimeout(updater.ProcessUnsafe());
+
+    time_t currentTime = GameTime::GetGameTime().count();
+    auto queueSize{ _recvQueue.Size() };
+
+    if (queueSize >= MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
+        LOG_WARN("network", "Found potential packet flood from: {}. Queue size: {}", GetPlayerInfo(), queueSize);
+
+    ///- Retrieve packets from the receive queue and call the appropriate handlers
+    uint32 processedPackets = ProcessPackets(updater);
 
     METRIC_VALUE("processed_packets", processedPackets);
     METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
@@ -27,6 +27,7 @@
 #include "CircularBuffer.h"
 #include "Common.h"
 #include "DatabaseEnvFwd.h"
+#include "FilteredMPSCQueue.h"
 #include "GossipDef.h"
 #include "Packet.h"
 #include "SharedDefines.h"
@@ -34,6 +35,7 @@
 #include <map>
 #include <utility>
 
+class ClientOpcodeHandler;
 class Creature;
 class GameObject;
 class InstanceSave;
@@ -43,6 +45,7 @@ class Object;
 class Pet;
 class Player;
 class Quest;
+class SharedWorldPacket;
 class SpellCastTargets;
 class Unit;
 class Warden;
@@ -274,6 +277,18 @@ public:
     bool Process(WorldPacket* packet) override;
 };
 
+//class used to filter the read-only thread-unsafe packets at the front of the queue
+//World::UpdateSessions() processes these for all sessions in parallel before its serial pass
+class WH_GAME_API ParallelSessionFilter : public PacketFilter
+{
+public:
+    explicit ParallelSessionFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~ParallelSessionFilter() override = default;
+
+    bool Process(WorldPacket* packet) override;
+    [[nodiscard]] bool ProcessUnsafe() const override { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class WH_GAME_API CharacterCreateInfo
@@ -356,6 +371,10 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(SharedWorldPacket& packet);
+
+    /// Payload bytes broadcasts did not have to copy because receivers shared one packet
+    static uint64 GetSharedPacketBytesSaved() { return _sharedPacketBytesSaved.load(std::memory_order_relaxed); }
 
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
@@ -389,6 +408,7 @@ public:
 
     /// Session in auth.queue currently
     void SetInQueue(bool state) { m_inQueue = state; }
+    bool IsInQueue() const { return m_inQueue; }
 
     /// Is the user engaged in a log out process?
     bool isLogingOut() const { return _logoutTime || m_playerLogout; }
@@ -417,8 +437,13 @@ public:
     bool DisallowHyperlinksAndMaybeKick(std::string_view str);
 
     void QueuePacket(WorldPacket* new_packet);
+    std::size_t GetRecvQueueSize() const { return _recvQueue.Size(); }
     bool Update(uint32 diff, PacketFilter& updater);
 
+    /// Handles the PROCESS_THREADUNSAFE_READONLY packets at the front of the receive queue, may run concurrently with other sessions
+    /// Returns the number of handled packets
+    uint32 ProcessReadOnlyPackets();
+
     /// Handle the authentication waiting queue (to be completed)
     void SendAuthWaitQueue(uint32 position);
 
@@ -1082,6 +1107,10 @@ public:                                                 // opcodes handlers
     void InitializeSessionCallback(CharacterDatabaseQueryHolder const& realmHolder, uint32 clientCacheVersion);
 
 private:
+    uint32 ProcessPackets(PacketFilter& updater);
+
+    /// runs the handler, timed when the opcode profiler is enabled
+    void CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet);
     void ProcessQueryCallbacks();
 
     QueryCallbackProcessor _queryProcessor;
@@ -1172,7 +1201,7 @@ private:
     AddonsList m_addonsList;
     uint32 recruiterId;
     bool isRecruiter;
-    LockedQueue<WorldPacket*> _recvQueue;
+    FilteredMPSCQueue<WorldPacket, &WorldPacket::QueueLink> _recvQueue;
     uint32 m_currentVendorEntry;
     ObjectGuid m_currentBankerGUID;
     uint32 _offlineTime;
@@ -1183,6 +1212,10 @@ private:
     // Addon Message count for Metric
     std::atomic<uint32> _addonMessageReceiveCount;
 
+    bool CanSendPacket(WorldPacket const* packet);
+
+    static std::atomic<uint64> _sharedPacketBytesSaved;
+
     CircularBuffer<std::pair<int64, uint32>> _timeSyncClockDeltaQueue; // first member: clockDelta. Second member: latency of the packet exchange that was used to compute that clockDelta.
     int64 _timeSyncClockDelta;
     void ComputeNewClockDelta();
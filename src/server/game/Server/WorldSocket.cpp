@@ -39,6 +39,11 @@
 
 using boost::asio::ip::tcp;
 
+// Payloads of at least this size are sent from the packet itself instead of being copied into the send buffer
+#define WORLD_SOCKET_IN_PLACE_PAYLOAD_SIZE 1024
+
+std::array<std::atomic<uint64>, WorldSocketSendLatencyBuckets.size() + 1> WorldSocket::_sendLatency = { };
+
 WorldSocket::WorldSocket(tcp::socket&& socket)
     : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096)
 {
@@ -105,48 +110,81 @@ void WorldSocket::CheckIpCallback(PreparedQueryResult result)
 }
 
 bool WorldSocket::Update()
+{
+    WriteQueuedPackets();
+
+    if (!BaseSocket::Update())
+        return false;
+
+    _queryProcessor.ProcessReadyCallbacks();
+    return true;
+}
+
+void WorldSocket::Flush()
+{
+    ClearFlushRequest();
+    WriteQueuedPackets();
+    BaseSocket::Update();
+}
+
+void WorldSocket::WriteQueuedPackets()
 {
     EncryptablePacket* queued;
-    MessageBuffer buffer(_sendBufferSize);
+    MessageBuffer buffer(std::size_t(0));
+    TimePoint now = std::chrono::steady_clock::now();
     while (_bufferQueue.Dequeue(queued))
     {
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+        RecordSendLatency(queued->GetQueueTime(), now);
+
+        WorldPacket const& packet = queued->GetPacket();
+        ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
         if (queued->NeedsEncryption())
             _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
-        {
-            QueuePacket(std::move(buffer));
-            buffer.Resize(_sendBufferSize);
-        }
+        std::size_t headerSize = header.getHeaderLength();
+        bool sendPayloadInPlace = !packet.empty() && (packet.size() >= WORLD_SOCKET_IN_PLACE_PAYLOAD_SIZE || packet.size() + headerSize > _sendBufferSize);
+        std::size_t bufferedSize = sendPayloadInPlace ? headerSize : packet.size() + headerSize;
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() < bufferedSize)
         {
-            buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
+            if (buffer.GetActiveSize() > 0)
+                QueuePacket(std::move(buffer));
+
+            buffer.Resize(std::max(_sendBufferSize, bufferedSize));
         }
-        else    // single packet larger than 4096 bytes
-        {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
-            packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
 
-            QueuePacket(std::move(packetBuffer));
+        buffer.Write(header.header, headerSize);
+
+        if (sendPayloadInPlace)
+        {
+            // large payloads are written straight from the packet storage, only the header is copied
+            QueuePacket(std::move(buffer));
+            QueuePacket(queued->GetSharedPacket(), packet.contents(), packet.size());
         }
+        else if (!packet.empty())
+            buffer.Write(packet.contents(), packet.size());
 
         delete queued;
     }
 
     if (buffer.GetActiveSize() > 0)
         QueuePacket(std::move(buffer));
+}
 
-    if (!BaseSocket::Update())
-        return false;
+void WorldSocket::RecordSendLatency(TimePoint queueTime, TimePoint now)
+{
+    uint64 latency = now > queueTime ? std::chrono::duration_cast<Microseconds>(now - queueTime).count() : 0;
+    std::size_t bucket = std::lower_bound(WorldSocketSendLatencyBuckets.begin(), WorldSocketSendLatencyBuckets.end(), latency) - WorldSocketSendLatencyBuckets.begin();
+    _sendLatency[bucket].fetch_add(1, std::memory_order_relaxed);
+}
 
-    _queryProcessor.ProcessReadyCallbacks();
-    return true;
+std::array<uint64, WorldSocketSendLatencyBuckets.size() + 1> WorldSocket::CollectSendLatency()
+{
+    std::array<uint64, WorldSocketSendLatencyBuckets.size() + 1> counts;
+    for (std::size_t i = 0; i < counts.size(); ++i)
+        counts[i] = _sendLatency[i].exchange(0, std::memory_order_relaxed);
+
+    return counts;
 }
 
 void WorldSocket::HandleSendAuthSession()
@@ -447,6 +485,19 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+    RequestFlush();
+}
+
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+    RequestFlush();
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
@@ -29,22 +29,38 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptablePacket : public WorldPacket
+class EncryptablePacket
 {
 public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptablePacket(WorldPacket const& packet, bool encrypt) : _packet(std::make_shared<WorldPacket const>(packet)), _encrypt(encrypt),
+        _queueTime(std::chrono::steady_clock::now())
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : _packet(std::move(packet)), _encrypt(encrypt),
+        _queueTime(std::chrono::steady_clock::now())
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorldPacket const& GetPacket() const { return *_packet; }
+    std::shared_ptr<WorldPacket const> const& GetSharedPacket() const { return _packet; }
+
     bool NeedsEncryption() const { return _encrypt; }
+    TimePoint GetQueueTime() const { return _queueTime; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _packet;
     bool _encrypt;
+    TimePoint _queueTime;
 };
 
+/// Upper bounds in microseconds of the send latency histogram buckets, the last bucket counts everything above
+constexpr std::array<uint32, 8> WorldSocketSendLatencyBuckets = { 50, 100, 250, 500, 1000, 2500, 5000, 10000 };
+
 namespace WorldPackets
 {
     class ServerPacket;
@@ -77,11 +93,18 @@ public:
 
     void Start() override;
     bool Update() override;
+    void Flush() override;
 
     void SendPacket(WorldPacket const& packet);
 
+    /// Queues a packet that other sockets may share, the payload is never copied or modified
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
+
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
+    /// Time from SendPacket until the packet reached the socket write queue, counts per bucket since the last call
+    static std::array<uint64, WorldSocketSendLatencyBuckets.size() + 1> CollectSendLatency();
+
 protected:
     void OnClose() override;
     void ReadHandler() override;
@@ -99,6 +122,10 @@ protected:
 private:
     void CheckIpCallback(PreparedQueryResult result);
 
+    /// moves packets from _bufferQueue to the socket write queue
+    void WriteQueuedPackets();
+    static void RecordSendLatency(TimePoint queueTime, TimePoint now);
+
     /// writes network.opcode log
     /// accessing WorldSession is not threadsafe, only do it when holding _worldSessionLock
     void LogOpcodeText(OpcodeClient opcode, std::unique_lock<std::mutex> const& guard) const;
@@ -130,6 +157,8 @@ private:
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
+
+    static std::array<std::atomic<uint64>, WorldSocketSendLatencyBuckets.size() + 1> _sendLatency;
 };
 
 #endif
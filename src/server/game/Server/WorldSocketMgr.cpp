@@ -25,9 +25,17 @@
 #include "WorldSocket.h"
 #include <boost/system/error_code.hpp>
 
+// Sockets request a flush whenever a packet is queued, the periodic walk only handles query callbacks and closed sockets
+#define WORLD_SOCKET_THREAD_UPDATE_INTERVAL 10ms
+
 class WorldSocketThread : public NetworkThread<WorldSocket>
 {
 public:
+    WorldSocketThread()
+    {
+        SetUpdateInterval(WORLD_SOCKET_THREAD_UPDATE_INTERVAL);
+    }
+
     void SocketAdded(std::shared_ptr<WorldSocket> sock) override
     {
         sock->SetSendBufferSize(sWorldSocketMgr.GetApplicationSendBufferSize());
@@ -68,6 +76,27 @@ bool WorldSocketMgr::StartWorldNetwork(Warhead::Asio::IoContext& ioContext, std:
         return false;
     }
 
+    // 0 keeps the mode of the I/O backend the server was built with
+    switch (sConfigMgr->GetOption<uint8>("Network.WriteMode", 0))
+    {
+        case 0:
+            SocketWriteOptions::SetMode(SocketWriteOptions::GetDefaultMode());
+            break;
+        case 1:
+            if (!SocketWriteOptions::SetMode(SocketWriteMode::Reactor))
+                LOG_ERROR("network", "Network.WriteMode 1 is not supported by the I/O backend, using completion writes");
+            break;
+        case 2:
+            SocketWriteOptions::SetMode(SocketWriteMode::Completion);
+            break;
+        default:
+            LOG_ERROR("network", "Network.WriteMode is wrong in your config file, using the default of the I/O backend");
+            SocketWriteOptions::SetMode(SocketWriteOptions::GetDefaultMode());
+            break;
+    }
+
+    LOG_INFO("network", "Using {} socket writes", SocketWriteOptions::GetMode() == SocketWriteMode::Completion ? "completion" : "reactor");
+
     if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
         return false;
 
@@ -0,0 +1,200 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "StartupLoader.h"
+#include "Errors.h"
+#include "Log.h"
+#include "ThreadPool.h"
+#include "Timer.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+void StartupLoader::Add(std::string_view name, std::initializer_list<std::string_view> dependencies, LoaderFunction loader)
+{
+    std::vector<std::size_t> dependencyIndexes;
+    dependencyIndexes.reserve(dependencies.size());
+
+    // resolve before adding, a loader can not depend on itself
+    for (std::string_view dependency : dependencies)
+        dependencyIndexes.emplace_back(GetLoaderIndex(dependency));
+
+    std::size_t index = AddLoader(name, std::move(loader));
+
+    if (_lastExclusive)
+        AddDependency(index, *_lastExclusive);
+
+    for (std::size_t dependency : dependencyIndexes)
+        AddDependency(index, dependency);
+}
+
+void StartupLoader::AddExclusive(std::string_view name, LoaderFunction loader)
+{
+    std::size_t firstAfterExclusive = _lastExclusive ? *_lastExclusive : 0;
+    std::size_t index = AddLoader(name, std::move(loader));
+
+    for (std::size_t i = firstAfterExclusive; i < index; ++i)
+        AddDependency(index, i);
+
+    _lastExclusive = index;
+}
+
+std::size_t StartupLoader::AddLoader(std::string_view name, LoaderFunction&& loader)
+{
+    Loader& newLoader = _loaders.emplace_back();
+    newLoader.Name = name;
+    newLoader.Function = std::move(loader);
+    return _loaders.size() - 1;
+}
+
+void StartupLoader::AddDependency(std::size_t index, std::size_t dependency)
+{
+    std::vector<std::size_t>& dependencies = _loaders[index].Dependencies;
+    if (std::find(dependencies.begin(), dependencies.end(), dependency) != dependencies.end())
+        return;
+
+    dependencies.emplace_back(dependency);
+    _loaders[dependency].Dependents.emplace_back(index);
+}
+
+std::size_t StartupLoader::GetLoaderIndex(std::string_view name) const
+{
+    auto itr = std::find_if(_loaders.begin(), _loaders.end(), [name](Loader const& loader) { return loader.Name == name; });
+    if (itr == _loaders.end())
+        ABORT("StartupLoader: dependency '{}' is not a loader added before", name);
+
+    return std::distance(_loaders.begin(), itr);
+}
+
+void StartupLoader::Run(uint32 threads)
+{
+    if (!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    TimePoint startTime = std::chrono::steady_clock::now();
+
+    if (threads == 1)
+    {
+        for (std::size_t i = 0; i < _loaders.size(); ++i)
+            RunLoader(i, startTime);
+    }
+    else
+        RunParallel(threads, startTime);
+
+    LogTimings(threads, std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - startTime));
+    _loaders.clear();
+    _lastExclusive.reset();
+}
+
+void StartupLoader::RunLoader(std::size_t index, TimePoint startTime)
+{
+    Loader& loader = _loaders[index];
+
+    LOG_INFO("server.loading", "Loading {}...", loader.Name);
+
+    TimePoint loaderStart = std::chrono::steady_clock::now();
+    loader.Function();
+
+    loader.Start = std::chrono::duration_cast<Microseconds>(loaderStart - startTime);
+    loader.Duration = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - loaderStart);
+}
+
+void StartupLoader::RunParallel(uint32 threads, TimePoint startTime)
+{
+    Warhead::ThreadPool pool(threads);
+
+    // Dependencies each loader still waits for, the thread finishing the last one posts it
+    std::vector<std::atomic<std::size_t>> pending(_loaders.size());
+    for (std::size_t i = 0; i < _loaders.size(); ++i)
+        pending[i].store(_loaders[i].Dependencies.size(), std::memory_order_relaxed);
+
+    std::function<void(std::size_t)> run = [&](std::size_t index)
+    {
+        RunLoader(index, startTime);
+
+        for (std::size_t dependent : _loaders[index].Dependents)
+            if (pending[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                pool.PostWork([&run, dependent]() { run(dependent); });
+    };
+
+    for (std::size_t i = 0; i < _loaders.size(); ++i)
+        if (_loaders[i].Dependencies.empty())
+            pool.PostWork([&run, i]() { run(i); });
+
+    // returns once no work is left, including the work posted by the loaders
+    pool.Wait();
+}
+
+void StartupLoader::LogTimings(uint32 threads, Microseconds elapsed) const
+{
+    if (_loaders.empty())
+        return;
+
+    // Longest chain of dependencies, the fastest the loaders can run with enough threads
+    std::vector<Microseconds> pathTime(_loaders.size());
+    std::vector<Optional<std::size_t>> pathPrevious(_loaders.size());
+    std::size_t pathEnd = 0;
+    Microseconds serialTime = 0us;
+
+    for (std::size_t i = 0; i < _loaders.size(); ++i)
+    {
+        for (std::size_t dependency : _loaders[i].Dependencies)
+        {
+            if (!pathPrevious[i] || pathTime[dependency] > pathTime[*pathPrevious[i]])
+                pathPrevious[i] = dependency;
+        }
+
+        pathTime[i] = _loaders[i].Duration + (pathPrevious[i] ? pathTime[*pathPrevious[i]] : 0us);
+        serialTime += _loaders[i].Duration;
+
+        if (pathTime[i] > pathTime[pathEnd])
+            pathEnd = i;
+    }
+
+    std::vector<std::size_t> criticalPath;
+    for (Optional<std::size_t> i = pathEnd; i; i = pathPrevious[*i])
+        criticalPath.emplace_back(*i);
+
+    std::reverse(criticalPath.begin(), criticalPath.end());
+
+    LOG_INFO("server.loading", ">> Ran {} loaders on {} threads in {} (one by one: {})", _loaders.size(), threads,
+        Warhead::Time::ToTimeString(elapsed), Warhead::Time::ToTimeString(serialTime));
+
+    LOG_INFO("server.loading", ">> Critical path: {} loaders, {}", criticalPath.size(), Warhead::Time::ToTimeString(pathTime[pathEnd]));
+    for (std::size_t i : criticalPath)
+        LOG_INFO("server.loading", "   {:<48} {}", _loaders[i].Name, Warhead::Time::ToTimeString(_loaders[i].Duration));
+
+    std::vector<std::size_t> byDuration(_loaders.size());
+    for (std::size_t i = 0; i < byDuration.size(); ++i)
+        byDuration[i] = i;
+
+    std::sort(byDuration.begin(), byDuration.end(), [this](std::size_t left, std::size_t right)
+    {
+        return _loaders[left].Duration > _loaders[right].Duration;
+    });
+
+    LOG_INFO("server.loading", ">> Loader timings:");
+    for (std::size_t i : byDuration)
+        LOG_INFO("server.loading", "   {:<48} {} (started at {})", _loaders[i].Name,
+            Warhead::Time::ToTimeString(_loaders[i].Duration), Warhead::Time::ToTimeString(_loaders[i].Start));
+
+    LOG_INFO("server.loading", "");
+}
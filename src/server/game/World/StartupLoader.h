@@ -0,0 +1,73 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _STARTUP_LOADER_H_
+#define _STARTUP_LOADER_H_
+
+#include "Define.h"
+#include "Duration.h"
+#include "Optional.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Runs the world startup loaders as a dependency graph on a thread pool.
+/// A loader can only depend on loaders added before it, so the graph never has a cycle
+/// and the order of the Add() calls is always a valid order to run them one by one.
+/// Only the declared dependencies are kept, not the order the loaders had before they were added here.
+class WH_GAME_API StartupLoader
+{
+public:
+    using LoaderFunction = std::function<void()>;
+
+    /// Loader that starts once all of its dependencies are done
+    void Add(std::string_view name, std::initializer_list<std::string_view> dependencies, LoaderFunction loader);
+
+    /// Loader that runs alone: after every loader added before it and before every loader added after it.
+    /// Used by the loaders that patch data other loaders read (SpellInfo, creature and quest templates).
+    void AddExclusive(std::string_view name, LoaderFunction loader);
+
+    /// Runs all loaders, 0 threads uses one per core and 1 runs them one by one in the order they were added
+    void Run(uint32 threads);
+
+private:
+    struct Loader
+    {
+        std::string Name;
+        LoaderFunction Function;
+        std::vector<std::size_t> Dependencies;
+        std::vector<std::size_t> Dependents;
+        Microseconds Start{ 0 };
+        Microseconds Duration{ 0 };
+    };
+
+    std::size_t AddLoader(std::string_view name, LoaderFunction&& loader);
+    void AddDependency(std::size_t index, std::size_t dependency);
+    std::size_t GetLoaderIndex(std::string_view name) const;
+
+    void RunLoader(std::size_t index, TimePoint startTime);
+    void RunParallel(uint32 threads, TimePoint startTime);
+    void LogTimings(uint32 threads, Microseconds elapsed) const;
+
+    std::vector<Loader> _loaders;
+    Optional<std::size_t> _lastExclusive;
+};
+
+#endif
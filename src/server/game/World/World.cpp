@@ -74,15 +74,18 @@
 #include "M2Stores.h"
 #include "MMapFactory.h"
 #include "MapMgr.h"
+#include "MapUpdater.h"
 #include "Metric.h"
 #include "ModulesConfig.h"
 #include "MotdMgr.h"
 #include "ObjectMgr.h"
+#include "OpcodeProfiler.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerSaveScheduler.h"
 #include "PoolMgr.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
@@ -91,12 +94,14 @@
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "StopWatch.h"
 #include "TaskScheduler.h"
 #include "TicketMgr.h"
 #include "Tokenize.h"
 #include "Transport.h"
 #include "TransportMgr.h"
+#include "UpdateData.h"
 #include "UpdateTime.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
@@ -437,6 +442,8 @@ void World::LoadConfigSettings(bool reload)
 
     // load update time related configs
     sWorldUpdateTime.LoadFromConfig();
+    sOpcodeProfiler->LoadFromConfig();
+    sPlayerSaveScheduler->LoadFromConfig();
 
     if (reload)
     {
@@ -646,390 +653,155 @@ void World::SetInitialWorldSettings()
     ///- Initilize static helper structures
     AIRegistry::Initialize();
 
-    LOG_INFO("server.loading", "Loading SpellInfo Store...");
-    sSpellMgr->LoadSpellInfoStore();
-
-    LOG_INFO("server.loading", "Loading Spell Cooldown Overrides...");
-    sSpellMgr->LoadSpellCooldownOverrides();
-
-    LOG_INFO("server.loading", "Loading SpellInfo Data Corrections...");
-    sSpellMgr->LoadSpellInfoCorrections();
-
-    LOG_INFO("server.loading", "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
-
-    LOG_INFO("server.loading", "Loading Spell Specific And Aura State...");
-    sSpellMgr->LoadSpellSpecificAndAuraState();
-
-    LOG_INFO("server.loading", "Loading SkillLineAbilityMultiMap Data...");
-    sSpellMgr->LoadSkillLineAbilityMap();
-
-    LOG_INFO("server.loading", "Loading SpellInfo Custom Attributes...");
-    sSpellMgr->LoadSpellInfoCustomAttributes();
-
-    LOG_INFO("server.loading", "Loading GameObject Models...");
-    LoadGameObjectModelList(_dataPath);
-
-    LOG_INFO("server.loading", "Loading Script Names...");
-    sObjectMgr->LoadScriptNames();
-
-    LOG_INFO("server.loading", "Loading Instance Template...");
-    sObjectMgr->LoadInstanceTemplate();
-
-    LOG_INFO("server.loading", "Loading Instance Saved Gameobject State Data...");
-    sObjectMgr->LoadInstanceSavedGameobjectStateData();
-
-    LOG_INFO("server.loading", "Loading Character Cache...");
-    sCharacterCache->LoadCharacterCacheStorage();
-
-    // Must be called before `creature_respawn`/`gameobject_respawn` tables
-    LOG_INFO("server.loading", "Loading Instances...");
-    sInstanceSaveMgr->LoadInstances();
-
-    LOG_INFO("server.loading", "Loading Game locale texts...");
-    sGameLocale->LoadAllLocales();
-
-    LOG_INFO("server", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
-
-    LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
-
-    LOG_INFO("server.loading", "Loading Game Object Template Addons...");
-    sObjectMgr->LoadGameObjectTemplateAddons();
-
-    LOG_INFO("server.loading", "Loading Transport Templates...");
-    sTransportMgr->LoadTransportTemplates();
-
-    LOG_INFO("server.loading", "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-
-    LOG_INFO("server.loading", "Loading Spell Group Types...");
-    sSpellMgr->LoadSpellGroups();
-
-    LOG_INFO("server.loading", "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-
-    LOG_INFO("server.loading", "Loading Spell Proc Event Conditions...");
-    sSpellMgr->LoadSpellProcEvents();
-
-    LOG_INFO("server.loading", "Loading Spell Proc Conditions and Data...");
-    sSpellMgr->LoadSpellProcs();
-
-    LOG_INFO("server.loading", "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonuses();
-
-    LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-
-    LOG_INFO("server.loading", "Loading Mixology Bonuses...");
-    sSpellMgr->LoadSpellMixology();
-
-    LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-
-    LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
-    LOG_INFO("server.loading", "Loading Enchant Spells Proc Datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-
-    LOG_INFO("server.loading", "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    LOG_INFO("server.loading", "Loading Disables");
-    DisableMgr::LoadDisables();                                  // must be before loading quests and items
-
-    LOG_INFO("server.loading", "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
-
-    LOG_INFO("server.loading", "Loading Item Set Names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemSetNames();
-
-    LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
-
-    LOG_INFO("server.loading", "Loading Creature Custom IDs Config...");
-    sObjectMgr->LoadCreatureCustomIDs();
-
-    LOG_INFO("server.loading", "Loading Creature Templates...");
-    sObjectMgr->LoadCreatureTemplates();
-
-    LOG_INFO("server.loading", "Loading Equipment Templates...");           // must be after LoadCreatureTemplates
-    sObjectMgr->LoadEquipmentTemplates();
-
-    LOG_INFO("server.loading", "Loading Creature Template Addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
-
-    LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-
-    LOG_INFO("server.loading", "Loading Reputation Spillover Data..." );
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    LOG_INFO("server.loading", "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    LOG_INFO("server.loading", "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
-
-    LOG_INFO("server.loading", "Loading Creature Data...");
-    sObjectMgr->LoadCreatures();
-
-    LOG_INFO("server.loading", "Loading Temporary Summon Data...");
-    sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
-
-    LOG_INFO("server.loading", "Loading Pet Levelup Spells...");
-    sSpellMgr->LoadPetLevelupSpellMap();
-
-    LOG_INFO("server.loading", "Loading Pet default Spells additional to Levelup Spells...");
-    sSpellMgr->LoadPetDefaultSpells();
-
-    LOG_INFO("server.loading", "Loading Creature Addon Data...");
-    sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
-
-    LOG_INFO("server.loading", "Loading Creature Movement Overrides...");
-    sObjectMgr->LoadCreatureMovementOverrides(); // must be after LoadCreatures()
-
-    LOG_INFO("server.loading", "Loading Gameobject Data...");
-    sObjectMgr->LoadGameobjects();
-
-    LOG_INFO("server.loading", "Loading GameObject Addon Data...");
-    sObjectMgr->LoadGameObjectAddons();                          // must be after LoadGameObjectTemplate() and LoadGameobjects()
-
-    LOG_INFO("server.loading", "Loading GameObject Quest Items...");
-    sObjectMgr->LoadGameObjectQuestItems();
-
-    LOG_INFO("server.loading", "Loading Creature Quest Items...");
-    sObjectMgr->LoadCreatureQuestItems();
-
-    LOG_INFO("server.loading", "Loading Creature Linked Respawn...");
-    sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
-
-    LOG_INFO("server.loading", "Loading Weather Data...");
-    WeatherMgr::LoadWeatherData();
-
-    LOG_INFO("server.loading", "Loading Quests...");
-    sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
-
-    LOG_INFO("server.loading", "Checking Quest Disables");
-    DisableMgr::CheckQuestDisables();                           // must be after loading quests
-
-    LOG_INFO("server.loading", "Loading Quest POI");
-    sObjectMgr->LoadQuestPOI();
-
-    // Loading Quests Starters and Enders
-    sObjectMgr->LoadQuestStartersAndEnders();                    // must be after quest load
-
-    LOG_INFO("server.loading", "Loading Quest Greetings...");
-    sObjectMgr->LoadQuestGreetings();                               // must be loaded after creature_template, gameobject_template tables
-
-    //LOG_INFO("server.loading", "Loading Quest Greeting Locales...");
-    //sObjectMgr->LoadQuestGreetingsLocales();                        // must be loaded after creature_template, gameobject_template tables
-
-    LOG_INFO("server.loading", "Loading Quest Money Rewards...");
-    sObjectMgr->LoadQuestMoneyRewards();
-
-    LOG_INFO("server.loading", "Loading Objects Pooling Data...");
-    sPoolMgr->LoadFromDB();
-
-    LOG_INFO("server.loading", "Loading Game Event Data...");               // must be after loading pools fully
-    sGameEventMgr->LoadHolidayDates();                           // Must be after loading DBC
-    sGameEventMgr->LoadFromDB();                                 // Must be after loading holiday dates
-
-    LOG_INFO("server.loading", "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
-    sObjectMgr->LoadNPCSpellClickSpells();
-
-    LOG_INFO("server.loading", "Loading Vehicle Template Accessories...");
-    sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-
-    LOG_INFO("server.loading", "Loading Vehicle Accessories...");
-    sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-
-    LOG_INFO("server.loading", "Loading SpellArea Data...");                // must be after quest load
-    sSpellMgr->LoadSpellAreas();
-
-    LOG_INFO("server.loading", "Loading Area Trigger Definitions");
-    sObjectMgr->LoadAreaTriggers();
-
-    LOG_INFO("server.loading", "Loading Area Trigger Teleport Definitions...");
-    sObjectMgr->LoadAreaTriggerTeleports();
-
-    LOG_INFO("server.loading", "Loading Access Requirements...");
-    sObjectMgr->LoadAccessRequirements();                        // must be after item template load
-
-    LOG_INFO("server.loading", "Loading Quest Area Triggers...");
-    sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
-
-    LOG_INFO("server.loading", "Loading Tavern Area Triggers...");
-    sObjectMgr->LoadTavernAreaTriggers();
-
-    LOG_INFO("server.loading", "Loading AreaTrigger Script Names...");
-    sObjectMgr->LoadAreaTriggerScripts();
-
-    LOG_INFO("server.loading", "Loading LFG Entrance Positions..."); // Must be after areatriggers
-    sLFGMgr->LoadLFGDungeons();
-
-    LOG_INFO("server.loading", "Loading Dungeon Boss Data...");
-    sObjectMgr->LoadInstanceEncounters();
-
-    LOG_INFO("server.loading", "Loading LFG Rewards...");
-    sLFGMgr->LoadRewards();
-
-    LOG_INFO("server.loading", "Loading Graveyard-Zone Links...");
-    sGraveyard->LoadGraveyardZones();
-
-    LOG_INFO("server.loading", "Loading Spell Pet Auras...");
-    sSpellMgr->LoadSpellPetAuras();
-
-    LOG_INFO("server.loading", "Loading Spell Target Coordinates...");
-    sSpellMgr->LoadSpellTargetPositions();
-
-    LOG_INFO("server.loading", "Loading Enchant Custom Attributes...");
-    sSpellMgr->LoadEnchantCustomAttr();
-
-    LOG_INFO("server.loading", "Loading linked Spells...");
-    sSpellMgr->LoadSpellLinked();
-
-    LOG_INFO("server.loading", "Loading Player Create Data...");
-    sObjectMgr->LoadPlayerInfo();
-
-    LOG_INFO("server.loading", "Loading Exploration BaseXP Data...");
-    sObjectMgr->LoadExplorationBaseXP();
-
-    LOG_INFO("server.loading", "Loading Pet Name Parts...");
-    sObjectMgr->LoadPetNames();
-
-    CharacterDatabaseCleaner::CleanDatabase();
-
-    LOG_INFO("server.loading", "Loading The Max Pet Number...");
-    sObjectMgr->LoadPetNumber();
-
-    LOG_INFO("server.loading", "Loading Pet Level Stats...");
-    sObjectMgr->LoadPetLevelInfo();
-
-    LOG_INFO("server.loading", "Loading Player Level Dependent Mail Rewards...");
-    sObjectMgr->LoadMailLevelRewards();
-
-    LOG_INFO("server.loading", "Load Mail Server Template...");
-    sObjectMgr->LoadMailServerTemplates();
-
-    // Loot tables
-    LoadLootTables();
-
-    LOG_INFO("server.loading", "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-
-    LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-
-    LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
-    LoadSkillPerfectItemTable();
-
-    LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
-
-    LOG_INFO("server.loading", "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-
-    LOG_INFO("server", "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-
-    LOG_INFO("server", "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-
-    LOG_INFO("server", "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-
-    LOG_INFO("server", "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
-
-    ///- Load dynamic data tables from the database
-    LOG_INFO("server.loading", "Loading Item Auctions...");
-    sAuctionMgr->LoadAuctionItems();
-
-    LOG_INFO("server", "Loading Auctions...");
-    sAuctionMgr->LoadAuctions();
-
-    sGuildMgr->LoadGuilds();
-
-    LOG_INFO("server.loading", "Loading ArenaTeams...");
-    sArenaTeamMgr->LoadArenaTeams();
-
-    LOG_INFO("server.loading", "Loading Groups...");
-    sGroupMgr->LoadGroups();
-
-    LOG_INFO("server.loading", "Loading Reserved Names...");
-    sObjectMgr->LoadReservedPlayersNames();
-
-    LOG_INFO("server.loading", "Loading Profanity Names...");
-    sObjectMgr->LoadProfanityPlayersNames();
-
-    LOG_INFO("server.loading", "Loading GameObjects for Quests...");
-    sObjectMgr->LoadGameObjectForQuests();
-
-    LOG_INFO("server.loading", "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
-
-    LOG_INFO("server.loading", "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
-
-    LOG_INFO("server.loading", "Loading Gossip Menu...");
-    sObjectMgr->LoadGossipMenu();
-
-    LOG_INFO("server.loading", "Loading Gossip Menu Options...");
-    sObjectMgr->LoadGossipMenuItems();
-
-    LOG_INFO("server.loading", "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-
-    LOG_INFO("server.loading", "Loading Trainers...");
-    sObjectMgr->LoadTrainerSpell();                              // must be after load CreatureTemplate
-
-    LOG_INFO("server.loading", "Loading Waypoints...");
-    sWaypointMgr->Load();
-
-    LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
-
-    LOG_INFO("server.loading", "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
-
-    LOG_INFO("server.loading", "Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
-    LoadWorldStates();
-
-    LOG_INFO("server.loading", "Loading Conditions...");
-    sConditionMgr->LoadConditions();
-
-    LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
-
-    LOG_INFO("server.loading", "Loading Faction Change Spell Pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
-
-    LOG_INFO("server.loading", "Loading Faction Change Item Pairs...");
-    sObjectMgr->LoadFactionChangeItems();
-
-    LOG_INFO("server.loading", "Loading Faction Change Reputation Pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
-
-    LOG_INFO("server.loading", "Loading Faction Change Title Pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
-
-    LOG_INFO("server.loading", "Loading Faction Change Quest Pairs...");
-    sObjectMgr->LoadFactionChangeQuests();
-
-    LOG_INFO("server.loading", "Loading GM Tickets...");
-    sTicketMgr->LoadTickets();
-
-    LOG_INFO("server.loading", "Loading GM Surveys...");
-    sTicketMgr->LoadSurveys();
-
-    LOG_INFO("server.loading", "Loading Client Addons...");
-    AddonMgr::LoadFromDB();
+    ///- Load the world data, every loader lists the loaders whose data it reads
+    StartupLoader loader;
+
+    // SpellInfo is patched by each of these, everything reading spells waits for the last one
+    loader.Add("SpellInfo Store", {}, []() { sSpellMgr->LoadSpellInfoStore(); });
+    loader.Add("Spell Cooldown Overrides", { "SpellInfo Store" }, []() { sSpellMgr->LoadSpellCooldownOverrides(); });
+    loader.Add("SpellInfo Data Corrections", { "Spell Cooldown Overrides" }, []() { sSpellMgr->LoadSpellInfoCorrections(); });
+    loader.Add("Spell Rank Data", { "SpellInfo Data Corrections" }, []() { sSpellMgr->LoadSpellRanks(); });
+    loader.Add("Spell Specific And Aura State", { "Spell Rank Data" }, []() { sSpellMgr->LoadSpellSpecificAndAuraState(); });
+    loader.Add("SkillLineAbilityMultiMap Data", { "Spell Specific And Aura State" }, []() { sSpellMgr->LoadSkillLineAbilityMap(); });
+    loader.Add("SpellInfo Custom Attributes", { "SkillLineAbilityMultiMap Data" }, []() { sSpellMgr->LoadSpellInfoCustomAttributes(); });
+
+    // Read by every gameobject that is created, the first ones are spawned after the loaders finished
+    loader.Add("GameObject Models", {}, [this]() { LoadGameObjectModelList(_dataPath); });
+
+    loader.Add("Script Names", {}, []() { sObjectMgr->LoadScriptNames(); });
+    loader.Add("Page Texts", {}, []() { sObjectMgr->LoadPageTexts(); });
+    loader.Add("Game Object Templates", { "Page Texts", "Script Names", "SpellInfo Custom Attributes" }, []() { sObjectMgr->LoadGameObjectTemplate(); });
+
+    // Sets the ignore line of sight attribute of spells
+    loader.AddExclusive("Disables", []() { DisableMgr::LoadDisables(); }); // must be before loading quests and items
+
+    loader.Add("Instance Template", { "Script Names" }, []() { sObjectMgr->LoadInstanceTemplate(); });
+    loader.Add("Instance Saved Gameobject State Data", {}, []() { sObjectMgr->LoadInstanceSavedGameobjectStateData(); });
+    loader.Add("Character Cache", {}, []() { sCharacterCache->LoadCharacterCacheStorage(); });
+    loader.Add("Instances", { "Instance Template", "Character Cache" }, []() { sInstanceSaveMgr->LoadInstances(); }); // Must be called before `creature_respawn`/`gameobject_respawn` tables
+    loader.Add("Game locale texts", {}, []() { sGameLocale->LoadAllLocales(); });
+    loader.Add("Game Object Template Addons", { "Game Object Templates" }, []() { sObjectMgr->LoadGameObjectTemplateAddons(); });
+    loader.Add("Transport Templates", { "Game Object Templates" }, []() { sTransportMgr->LoadTransportTemplates(); });
+    loader.Add("Spell Required Data", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellRequired(); });
+    loader.Add("Spell Group Types", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellGroups(); });
+    loader.Add("Spell Learn Skills", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellLearnSkills(); });
+    loader.Add("Spell Proc Event Conditions", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellProcEvents(); });
+    loader.Add("Spell Proc Conditions and Data", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellProcs(); });
+    loader.Add("Spell Bonus Data", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellBonuses(); });
+    loader.Add("Aggro Spells Definitions", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellThreats(); });
+    loader.Add("Mixology Bonuses", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellMixology(); });
+    loader.Add("Spell Group Stack Rules", { "Spell Group Types" }, []() { sSpellMgr->LoadSpellGroupStackRules(); });
+    loader.Add("Enchant Spells Proc Datas", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellEnchantProcData(); });
+    loader.Add("Spell Pet Auras", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellPetAuras(); });
+    loader.Add("Spell Target Coordinates", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellTargetPositions(); });
+    loader.Add("Enchant Custom Attributes", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadEnchantCustomAttr(); });
+    loader.Add("linked Spells", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadSpellLinked(); });
+    loader.Add("Pet Levelup Spells", { "SpellInfo Custom Attributes" }, []() { sSpellMgr->LoadPetLevelupSpellMap(); });
+    loader.Add("NPC Texts", { "Game locale texts" }, []() { sObjectMgr->LoadGossipText(); });
+    loader.Add("Item Random Enchantments Table", {}, []() { LoadRandomEnchantmentsTable(); });
+    loader.Add("Creature Model Based Info Data", {}, []() { sObjectMgr->LoadCreatureModelInfo(); });
+    loader.Add("Creature Custom IDs Config", {}, []() { sObjectMgr->LoadCreatureCustomIDs(); });
+    loader.Add("Reputation Reward Rates", {}, []() { sObjectMgr->LoadReputationRewardRate(); });
+    loader.Add("Reputation Spillover Data", {}, []() { sObjectMgr->LoadReputationSpilloverTemplate(); });
+    loader.Add("Points Of Interest Data", {}, []() { sObjectMgr->LoadPointsOfInterest(); });
+    loader.Add("Weather Data", {}, []() { WeatherMgr::LoadWeatherData(); });
+    loader.Add("Quest POI", {}, []() { sObjectMgr->LoadQuestPOI(); });
+    loader.Add("Quest Money Rewards", {}, []() { sObjectMgr->LoadQuestMoneyRewards(); });
+    loader.Add("Area Trigger Definitions", {}, []() { sObjectMgr->LoadAreaTriggers(); });
+    loader.Add("Area Trigger Teleport Definitions", { "Area Trigger Definitions" }, []() { sObjectMgr->LoadAreaTriggerTeleports(); });
+    loader.Add("Tavern Area Triggers", { "Area Trigger Definitions" }, []() { sObjectMgr->LoadTavernAreaTriggers(); });
+    loader.Add("AreaTrigger Script Names", { "Area Trigger Definitions", "Script Names" }, []() { sObjectMgr->LoadAreaTriggerScripts(); });
+    loader.Add("LFG Entrance Positions", { "Area Trigger Teleport Definitions" }, []() { sLFGMgr->LoadLFGDungeons(); });
+    loader.Add("Graveyard-Zone Links", {}, []() { sGraveyard->LoadGraveyardZones(); });
+    loader.Add("Exploration BaseXP Data", {}, []() { sObjectMgr->LoadExplorationBaseXP(); });
+    loader.Add("Pet Name Parts", {}, []() { sObjectMgr->LoadPetNames(); });
+    loader.Add("Character Database Cleanup", { "SpellInfo Custom Attributes" }, []() { CharacterDatabaseCleaner::CleanDatabase(); });
+    loader.Add("The Max Pet Number", {}, []() { sObjectMgr->LoadPetNumber(); });
+    loader.Add("Skill Discovery Table", { "SpellInfo Custom Attributes" }, []() { LoadSkillDiscoveryTable(); });
+    loader.Add("Skill Extra Item Table", { "SpellInfo Custom Attributes" }, []() { LoadSkillExtraItemTable(); });
+    loader.Add("Skill Fishing Base Level Requirements", {}, []() { sObjectMgr->LoadFishingBaseSkillLevel(); });
+    loader.Add("Achievements", {}, []() { sAchievementMgr->LoadAchievementReferenceList(); });
+    loader.Add("Achievement Criteria Lists", {}, []() { sAchievementMgr->LoadAchievementCriteriaList(); });
+    loader.Add("Completed Achievements", {}, []() { sAchievementMgr->LoadCompletedAchievements(); });
+    loader.Add("ArenaTeams", { "Character Cache" }, []() { sArenaTeamMgr->LoadArenaTeams(); });
+    loader.Add("Groups", { "Character Cache", "Instances" }, []() { sGroupMgr->LoadGroups(); });
+    loader.Add("Reserved Names", {}, []() { sObjectMgr->LoadReservedPlayersNames(); });
+    loader.Add("Profanity Names", {}, []() { sObjectMgr->LoadProfanityPlayersNames(); });
+    loader.Add("GameTeleports", {}, []() { sObjectMgr->LoadGameTele(); });
+    loader.Add("Gossip Menu", { "NPC Texts" }, []() { sObjectMgr->LoadGossipMenu(); });
+    loader.Add("Gossip Menu Options", { "Gossip Menu", "Points Of Interest Data", "Game locale texts" }, []() { sObjectMgr->LoadGossipMenuItems(); });
+    loader.Add("Waypoints", {}, []() { sWaypointMgr->Load(); });
+    loader.Add("SmartAI Waypoints", {}, []() { sSmartWaypointMgr->LoadFromDB(); });
+    loader.Add("World States", {}, [this]() { LoadWorldStates(); }); // must be loaded before battleground, outdoor PvP and conditions
+    loader.Add("Faction Change Achievement Pairs", {}, []() { sObjectMgr->LoadFactionChangeAchievements(); });
+    loader.Add("Faction Change Spell Pairs", { "SpellInfo Custom Attributes" }, []() { sObjectMgr->LoadFactionChangeSpells(); });
+    loader.Add("Faction Change Reputation Pairs", {}, []() { sObjectMgr->LoadFactionChangeReputations(); });
+    loader.Add("Faction Change Title Pairs", {}, []() { sObjectMgr->LoadFactionChangeTitles(); });
+    loader.Add("GM Tickets", {}, []() { sTicketMgr->LoadTickets(); });
+    loader.Add("GM Surveys", {}, []() { sTicketMgr->LoadSurveys(); });
+    loader.Add("Client Addons", {}, []() { AddonMgr::LoadFromDB(); });
+
+    loader.Add("Items", { "Disables", "Item Random Enchantments Table", "Page Texts" }, []() { sObjectMgr->LoadItemTemplates(); });
+    loader.Add("Item Set Names", { "Items" }, []() { sObjectMgr->LoadItemSetNames(); });
+    loader.Add("Creature Templates", { "Creature Model Based Info Data", "Creature Custom IDs Config", "Script Names", "SpellInfo Custom Attributes" }, []() { sObjectMgr->LoadCreatureTemplates(); });
+    loader.Add("Equipment Templates", { "Creature Templates" }, []() { sObjectMgr->LoadEquipmentTemplates(); });
+    loader.Add("Creature Template Addons", { "Creature Templates" }, []() { sObjectMgr->LoadCreatureTemplateAddons(); });
+    loader.Add("Creature Reputation OnKill Data", { "Creature Templates" }, []() { sObjectMgr->LoadReputationOnKill(); });
+    loader.Add("Creature Base Stats", { "Creature Templates" }, []() { sObjectMgr->LoadCreatureClassLevelStats(); });
+    // creatures and gameobjects share the map grid store and create the base maps, so they load one after the other
+    loader.Add("Creature Data", { "Creature Templates", "Equipment Templates", "Game Object Templates", "Instances" }, []() { sObjectMgr->LoadCreatures(); });
+    loader.Add("Temporary Summon Data", { "Creature Templates", "Game Object Templates" }, []() { sObjectMgr->LoadTempSummons(); });
+    loader.Add("Pet default Spells additional to Levelup Spells", { "Creature Templates" }, []() { sSpellMgr->LoadPetDefaultSpells(); });
+    loader.Add("Creature Addon Data", { "Creature Data" }, []() { sObjectMgr->LoadCreatureAddons(); });
+    loader.Add("Creature Movement Overrides", { "Creature Addon Data" }, []() { sObjectMgr->LoadCreatureMovementOverrides(); });
+    loader.Add("Gameobject Data", { "Game Object Templates", "Creature Data" }, []() { sObjectMgr->LoadGameobjects(); });
+    loader.Add("GameObject Addon Data", { "Gameobject Data" }, []() { sObjectMgr->LoadGameObjectAddons(); });
+    loader.Add("GameObject Quest Items", { "Game Object Templates" }, []() { sObjectMgr->LoadGameObjectQuestItems(); });
+    loader.Add("Creature Quest Items", { "Creature Templates" }, []() { sObjectMgr->LoadCreatureQuestItems(); });
+    loader.Add("Creature Linked Respawn", { "Creature Addon Data", "Gameobject Data" }, []() { sObjectMgr->LoadLinkedRespawn(); });
+    loader.Add("Quests", { "Disables", "Creature Templates", "Game Object Templates", "Items" }, []() { sObjectMgr->LoadQuests(); });
+    loader.Add("Quest Disables", { "Quests" }, []() { DisableMgr::CheckQuestDisables(); });
+    loader.Add("Quest Starters and Enders", { "Quests" }, []() { sObjectMgr->LoadQuestStartersAndEnders(); });
+    loader.Add("Quest Greetings", { "Creature Templates", "Game Object Templates" }, []() { sObjectMgr->LoadQuestGreetings(); });
+    loader.Add("Objects Pooling Data", { "Creature Linked Respawn", "Creature Movement Overrides", "GameObject Addon Data", "Quests" }, []() { sPoolMgr->LoadFromDB(); });
+    loader.Add("Holiday Dates", {}, []() { sGameEventMgr->LoadHolidayDates(); });
+    loader.Add("Access Requirements", { "Items", "Quests" }, []() { sObjectMgr->LoadAccessRequirements(); });
+    loader.Add("LFG Rewards", { "LFG Entrance Positions", "Quests" }, []() { sLFGMgr->LoadRewards(); });
+    loader.Add("Player Create Data", { "Items" }, []() { sObjectMgr->LoadPlayerInfo(); });
+    loader.Add("Pet Level Stats", { "Creature Templates" }, []() { sObjectMgr->LoadPetLevelInfo(); });
+    loader.Add("Player Level Dependent Mail Rewards", { "Creature Templates" }, []() { sObjectMgr->LoadMailLevelRewards(); });
+    loader.Add("Mail Server Template", { "Items" }, []() { sObjectMgr->LoadMailServerTemplates(); });
+    loader.Add("Loot Tables", { "Items", "Creature Templates", "Game Object Templates" }, []() { LoadLootTables(); });
+    loader.Add("Skill Perfection Data Table", { "Items" }, []() { LoadSkillPerfectItemTable(); });
+    loader.Add("Achievement Criteria Data", { "Achievement Criteria Lists", "Quest Disables", "Creature Templates", "Items" }, []() { sAchievementMgr->LoadAchievementCriteriaData(); });
+    loader.Add("Achievement Rewards", { "Creature Templates", "Items" }, []() { sAchievementMgr->LoadRewards(); });
+    loader.Add("Item Auctions", { "Items" }, []() { sAuctionMgr->LoadAuctionItems(); });
+    loader.Add("Auctions", { "Item Auctions", "Character Cache" }, []() { sAuctionMgr->LoadAuctions(); });
+    loader.Add("Guilds", { "Items", "Character Cache" }, []() { sGuildMgr->LoadGuilds(); });
+    loader.Add("Vendors", { "Creature Templates", "Items" }, []() { sObjectMgr->LoadVendors(); });
+    loader.Add("Trainers", { "Creature Templates" }, []() { sObjectMgr->LoadTrainerSpell(); });
+    loader.Add("Creature Formations", { "Creature Addon Data" }, []() { sFormationMgr->LoadCreatureFormations(); });
+    loader.Add("Faction Change Item Pairs", { "Items" }, []() { sObjectMgr->LoadFactionChangeItems(); });
+    loader.Add("Faction Change Quest Pairs", { "Quests" }, []() { sObjectMgr->LoadFactionChangeQuests(); });
+
+    // These patch quest, creature, gameobject templates or SpellInfo that the loaders above read
+    loader.AddExclusive("Game Event Data", []() // must be after loading pools fully
+    {
+        sGameEventMgr->LoadFromDB();
+    });
+    loader.AddExclusive("SpellArea Data", []() { sSpellMgr->LoadSpellAreas(); }); // must be after quest load
+    loader.AddExclusive("Quest Area Triggers", []() { sObjectMgr->LoadQuestAreaTriggers(); }); // must be after LoadQuests
+    loader.AddExclusive("Dungeon Boss Data", []() { sObjectMgr->LoadInstanceEncounters(); });
+    loader.AddExclusive("UNIT_NPC_FLAG_SPELLCLICK Data", []() { sObjectMgr->LoadNPCSpellClickSpells(); }); // must be after LoadQuests
+    loader.AddExclusive("BattleMasters", []() { sBattlegroundMgr->LoadBattleMastersEntry(); });
+    loader.AddExclusive("GameObjects for Quests", []() { sObjectMgr->LoadGameObjectForQuests(); });
+
+    loader.Add("Vehicle Template Accessories", { "UNIT_NPC_FLAG_SPELLCLICK Data" }, []() { sObjectMgr->LoadVehicleTemplateAccessories(); }); // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+    loader.Add("Vehicle Accessories", { "UNIT_NPC_FLAG_SPELLCLICK Data" }, []() { sObjectMgr->LoadVehicleAccessories(); }); // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+
+    loader.AddExclusive("Conditions", []() { sConditionMgr->LoadConditions(); });
+
+    loader.Run(CONF_GET_UINT("StartupLoader.Threads"));
 
     // pussywizard:
     LOG_INFO("server.loading", "Deleting Invalid Mail Items...");
@@ -1223,6 +995,8 @@ void World::SetInitialWorldSettings()
     sAsyncAuctionMgr->Initialize();
     sAuctionBot->Initialize();
 
+    sDBCacheMgr->CloseSnapshot();
+
     auto elapsed = sw.Elapsed();
     std::string startupDuration = Warhead::Time::ToTimeString(elapsed, sw.GetOutCount());
 
@@ -1295,7 +1069,8 @@ void World::Update(uint32 diff)
     // Record update if recording set in log and diff is greater then minimum set in log
     sWorldUpdateTime.RecordUpdateTime(getMSTime(), diff, GetActiveSessionCount());
 
-    DynamicVisibilityMgr::Update(GetActiveSessionCount());
+    DynamicVisibilityMgr::Update(diff, sWorldUpdateTime.GetAverageUpdateTime());
+    UpdateData::SetAverageWorldUpdateTime(sWorldUpdateTime.GetAverageUpdateTime());
 
     ///- Update the different timers
     for (auto& _timer : _timers)
@@ -1419,6 +1194,11 @@ void World::Update(uint32 diff)
         sLFGMgr->Update(diff, 0); // pussywizard: remove obsolete stuff before finding compatibility during map update
     }
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update player save scheduler"));
+        sPlayerSaveScheduler->Update(Milliseconds(diff));
+    }
+
     {
         ///- Update objects when the timer has passed (maps, transport, creatures, ...)
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maps"));
@@ -1554,6 +1334,7 @@ void World::ForceGameEventUpdate()
 /// Send a packet to all players (except self if mentioned)
 void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacket sharedPacket(packet);
     SessionMap::const_iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -1563,7 +1344,7 @@ void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, Tea
                 itr->second != self &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket);
         }
     }
 }
@@ -1571,6 +1352,7 @@ void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, Tea
 /// Send a packet to all GMs (except self if mentioned)
 void World::SendGlobalGMMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacket sharedPacket(packet);
     SessionMap::iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -1581,7 +1363,7 @@ void World::SendGlobalGMMessage(WorldPacket const* packet, WorldSession* self, T
                 !AccountMgr::IsPlayerAccount(itr->second->GetSecurity()) &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket);
         }
     }
 }
@@ -1601,6 +1383,7 @@ void World::SendGlobalText(std::string_view text, WorldSession* self)
 /// Send a packet to all players (or players selected team) in the zone (except self if mentioned)
 bool World::SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacket sharedPacket(packet);
     bool foundPlayerToSend = false;
     SessionMap::const_iterator itr;
 
@@ -1613,7 +1396,7 @@ bool World::SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession
                 itr->second != self &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket);
             foundPlayerToSend = true;
         }
     }
@@ -1847,6 +1630,35 @@ void World::UpdateSessions(uint32 diff)
         }
     }
 
+    ///- Handle the read-only thread-unsafe packets of all sessions on the map update threads
+    if (CONF_GET_BOOL("SessionUpdate.Parallel") && sMapMgr->GetMapUpdater()->IsActive())
+    {
+        METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+            METRIC_TAG("type", "Parallel sessions"),
+            METRIC_TAG("parent_type", "Update sessions"));
+
+        _parallelSessions.clear();
+        for (auto const& [accountId, session] : _sessions)
+            _parallelSessions.push_back(session);
+
+        std::atomic<uint32> processedPackets{ 0 };
+        MapUpdater* updater = sMapMgr->GetMapUpdater();
+        updater->ScheduleSessionsUpdate(_parallelSessions, processedPackets);
+        updater->WaitThreads();
+
+        METRIC_VALUE("session_update_pass_packets", uint64(processedPackets.load()), METRIC_TAG("pass", "parallel"));
+    }
+
+    // World thread time of the remaining one session at a time pass, compare with "Parallel sessions" above
+    METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+        METRIC_TAG("type", "Serial sessions"),
+        METRIC_TAG("parent_type", "Update sessions"));
+
+    // Receive queue depth of the sessions before their update, per session class
+    static constexpr std::array<char const*, 3> RecvQueueSessionClasses = { "queued", "character_select", "in_world" };
+    [[maybe_unused]] std::array<std::size_t, 3> recvQueueTotal{};
+    [[maybe_unused]] std::array<std::size_t, 3> recvQueueMax{};
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = _sessions.begin(), next; itr != _sessions.end(); itr = next)
     {
@@ -1880,6 +1692,11 @@ void World::UpdateSessions(uint32 diff)
             continue;
         }
 
+        std::size_t sessionClass = pSession->IsInQueue() ? 0 : (pSession->GetPlayer() ? 2 : 1);
+        std::size_t recvQueueSize = pSession->GetRecvQueueSize();
+        recvQueueTotal[sessionClass] += recvQueueSize;
+        recvQueueMax[sessionClass] = std::max(recvQueueMax[sessionClass], recvQueueSize);
+
         [[maybe_unused]] uint32 currentSessionId = itr->first;
         METRIC_DETAILED_TIMER("world_update_sessions_time", METRIC_TAG("account_id", std::to_string(currentSessionId)));
 
@@ -1892,6 +1709,12 @@ void World::UpdateSessions(uint32 diff)
         }
     }
 
+    for (std::size_t i = 0; i < RecvQueueSessionClasses.size(); ++i)
+    {
+        METRIC_VALUE("session_recv_queue_size", uint64(recvQueueTotal[i]), METRIC_TAG("class", RecvQueueSessionClasses[i]));
+        METRIC_VALUE("session_recv_queue_max", uint64(recvQueueMax[i]), METRIC_TAG("class", RecvQueueSessionClasses[i]));
+    }
+
     // pussywizard:
     if (_offlineSessions.empty())
         return;
@@ -357,6 +357,7 @@ private:
 
     SessionMap _sessions;
     SessionMap _offlineSessions;
+    std::vector<WorldSession*> _parallelSessions;
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap _disconnects;
     uint32 _maxActiveSessionCount;
@@ -33,6 +33,7 @@
 #include "GitRevision.h"
 #include "ModuleMgr.h"
 #include "MotdMgr.h"
+#include "OpcodeProfiler.h"
 #include "Player.h"
 #include "Realm.h"
 #include "ScriptObject.h"
@@ -87,6 +88,12 @@ public:
             { "closed",       HandleServerSetClosedCommand,      SEC_CONSOLE,       Console::Yes }
         };
 
+        static ChatCommandTable serverProfileCommandTable =
+        {
+            { "opcodes",      HandleServerProfileOpcodesCommand, SEC_ADMINISTRATOR, Console::Yes },
+            { "reset",        HandleServerProfileResetCommand,   SEC_ADMINISTRATOR, Console::Yes }
+        };
+
         static ChatCommandTable serverCommandTable =
         {
             { "corpses",      HandleServerCorpsesCommand,        SEC_GAMEMASTER,    Console::Yes },
@@ -96,6 +103,7 @@ public:
             { "idleshutdown", serverIdleShutdownCommandTable },
             { "info",         HandleServerInfoCommand,           SEC_PLAYER,        Console::Yes },
             { "motd",         HandleServerMotdCommand,           SEC_PLAYER,        Console::Yes },
+            { "profile",      serverProfileCommandTable },
             { "restart",      serverRestartCommandTable },
             { "shutdown",     serverShutdownCommandTable },
             { "set",          serverSetCommandTable }
@@ -520,6 +528,39 @@ public:
         return false;
     }
 
+    // Show the opcode handlers that took the most time
+    static bool HandleServerProfileOpcodesCommand(ChatHandler* handler, Optional<uint32> count)
+    {
+        if (!sOpcodeProfiler->IsEnabled())
+            handler->SendSysMessage("Opcode profiler is disabled (OpcodeProfiler.Enable), showing the last recorded values.");
+
+        std::vector<OpcodeProfileEntry> profile = sOpcodeProfiler->GetProfile();
+        if (profile.empty())
+        {
+            handler->SendSysMessage("No opcode handler calls recorded.");
+            return true;
+        }
+
+        std::size_t shown = std::min<std::size_t>(profile.size(), count.value_or(10));
+        handler->PSendSysMessage("Top {} of {} opcodes by total handler time:", shown, profile.size());
+
+        for (std::size_t i = 0; i < shown; ++i)
+        {
+            OpcodeProfileEntry const& entry = profile[i];
+            handler->PSendSysMessage("{}: {} calls, {:.2f}ms total, {}us avg, {}us max, {} bytes, {} slow", opcodeTable[entry.Opcode]->Name,
+                entry.Calls, entry.TotalTime / 1000.0f, entry.TotalTime / entry.Calls, entry.MaxTime, entry.Bytes, entry.SlowCalls);
+        }
+
+        return true;
+    }
+
+    static bool HandleServerProfileResetCommand(ChatHandler* handler)
+    {
+        sOpcodeProfiler->Reset();
+        handler->SendSysMessage("Opcode profile reset.");
+        return true;
+    }
+
     // set diff time record interval
     static bool HandleServerSetDiffTimeCommand(ChatHandler* /*handler*/, int32 newTime)
     {
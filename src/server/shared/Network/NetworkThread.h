@@ -20,9 +20,12 @@
 
 #include "DeadlineTimer.h"
 #include "Define.h"
+#include "Duration.h"
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "Metric.h"
+#include "Socket.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
 #include <memory>
@@ -35,9 +38,19 @@ using boost::asio::ip::tcp;
 template<class SocketType>
 class NetworkThread
 {
+    /// Held by the flush notifiers of the sockets, which may outlive the thread, Stop cuts it off from the thread
+    struct FlushTarget
+    {
+        std::mutex Lock;
+        NetworkThread* Thread;
+    };
+
 public:
-    NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _ioContext(1),
-        _acceptSocket(_ioContext), _updateTimer(_ioContext) { }
+    NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _updateInterval(1ms), _flushTarget(std::make_shared<FlushTarget>()),
+        _flushScheduled(false), _ioContext(1), _acceptSocket(_ioContext), _updateTimer(_ioContext)
+    {
+        _flushTarget->Thread = this;
+    }
 
     virtual ~NetworkThread()
     {
@@ -52,6 +65,11 @@ public:
 
     void Stop()
     {
+        {
+            std::lock_guard<std::mutex> lock(_flushTarget->Lock);
+            _flushTarget->Thread = nullptr;
+        }
+
         _stopped = true;
         _ioContext.stop();
     }
@@ -79,8 +97,13 @@ public:
         return _connections;
     }
 
+    /// Interval of the walk over all sockets, sockets that request flushes are written without waiting for it
+    void SetUpdateInterval(Milliseconds updateInterval) { _updateInterval = updateInterval; }
+
     virtual void AddSocket(std::shared_ptr<SocketType> sock)
     {
+        sock->SetFlushNotifier([target = _flushTarget](std::shared_ptr<SocketType> dirtySocket) { QueueFlush(*target, std::move(dirtySocket)); });
+
         std::lock_guard<std::mutex> lock(_newSocketsLock);
 
         ++_connections;
@@ -119,13 +142,49 @@ protected:
     {
         LOG_DEBUG("misc", "Network Thread Starting");
 
-        _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
+        _updateTimer.expires_from_now(boost::posix_time::milliseconds(_updateInterval.count()));
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
         _ioContext.run();
 
         LOG_DEBUG("misc", "Network Thread exits");
         _newSockets.clear();
         _sockets.clear();
+
+        std::lock_guard<std::mutex> lock(_flushTarget->Lock);
+        _dirtySockets.clear();
+    }
+
+    /// Thread safe, wakes the network thread once for any number of sockets queued before it runs, drops the socket once the thread is stopped
+    static void QueueFlush(FlushTarget& target, std::shared_ptr<SocketType> sock)
+    {
+        std::lock_guard<std::mutex> lock(target.Lock);
+
+        NetworkThread* thread = target.Thread;
+        if (!thread)
+            return;
+
+        thread->_dirtySockets.push_back(std::move(sock));
+
+        if (!thread->_flushScheduled.exchange(true, std::memory_order_acq_rel))
+            Warhead::Asio::post(thread->_ioContext, [thread]() { thread->FlushDirtySockets(); });
+    }
+
+    void FlushDirtySockets()
+    {
+        // cleared before taking the list, sockets queued from now on schedule another run
+        _flushScheduled.store(false, std::memory_order_release);
+
+        {
+            std::lock_guard<std::mutex> lock(_flushTarget->Lock);
+            std::swap(_dirtySockets, _flushingSockets);
+        }
+
+        // closed sockets are left to Update, which also removes them from _sockets
+        for (std::shared_ptr<SocketType> const& sock : _flushingSockets)
+            if (sock->IsOpen())
+                sock->Flush();
+
+        _flushingSockets.clear();
     }
 
     void Update()
@@ -133,11 +192,18 @@ protected:
         if (_stopped)
             return;
 
-        _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
+        _updateTimer.expires_from_now(boost::posix_time::milliseconds(_updateInterval.count()));
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
 
         AddNewSockets();
 
+        TimePoint now = std::chrono::steady_clock::now();
+        if (now >= _nextWriteCountersReport)
+        {
+            _nextWriteCountersReport = now + WRITE_COUNTERS_REPORT_INTERVAL;
+            ReportWriteCounters();
+        }
+
         _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> sock)
         {
             if (!sock->Update())
@@ -155,19 +221,39 @@ protected:
         }), _sockets.end());
     }
 
+    /// Reports the writes of the sockets owned by this thread, bytes per write show how well the write mode batches
+    void ReportWriteCounters()
+    {
+        SocketWriteCounters& counters = GetThreadSocketWriteCounters();
+        [[maybe_unused]] char const* mode = SocketWriteOptions::GetMode() == SocketWriteMode::Completion ? "completion" : "reactor";
+
+        METRIC_VALUE("network_socket_writes", counters.Writes, METRIC_TAG("mode", mode));
+        METRIC_VALUE("network_socket_write_bytes", counters.Bytes, METRIC_TAG("mode", mode));
+        counters = {};
+    }
+
 private:
     typedef std::vector<std::shared_ptr<SocketType>> SocketContainer;
 
+    static constexpr Seconds WRITE_COUNTERS_REPORT_INTERVAL = 10s;
+
     std::atomic<int32> _connections;
     std::atomic<bool> _stopped;
 
     std::thread* _thread;
+    Milliseconds _updateInterval;
+    TimePoint _nextWriteCountersReport{};
 
     SocketContainer _sockets;
 
     std::mutex _newSocketsLock;
     SocketContainer _newSockets;
 
+    std::shared_ptr<FlushTarget> _flushTarget;
+    SocketContainer _dirtySockets;
+    SocketContainer _flushingSockets;
+    std::atomic<bool> _flushScheduled;
+
     Warhead::Asio::IoContext _ioContext;
     tcp::socket _acceptSocket;
     Warhead::Asio::DeadlineTimer _updateTimer;
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Socket.h"
+
+SocketWriteMode SocketWriteOptions::_mode = SocketWriteOptions::GetDefaultMode();
+
+SocketWriteMode SocketWriteOptions::GetDefaultMode()
+{
+#if defined(BOOST_ASIO_HAS_IOCP) || (defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL))
+    return SocketWriteMode::Completion;
+#else
+    return SocketWriteMode::Reactor;
+#endif
+}
+
+bool SocketWriteOptions::SetMode(SocketWriteMode mode)
+{
+#ifdef BOOST_ASIO_HAS_IOCP
+    if (mode == SocketWriteMode::Reactor)
+        return false;
+#endif
+
+    _mode = mode;
+    return true;
+}
+
+SocketWriteCounters& GetThreadSocketWriteCounters()
+{
+    thread_local SocketWriteCounters counters;
+    return counters;
+}
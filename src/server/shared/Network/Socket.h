@@ -18,28 +18,90 @@
 #ifndef __SOCKET_H__
 #define __SOCKET_H__
 
+#include "Define.h"
 #include "Log.h"
 #include "MessageBuffer.h"
+#include <algorithm>
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
-#ifdef BOOST_ASIO_HAS_IOCP
-#define WH_SOCKET_USE_IOCP
-#endif
+// Upper bound of queued chunks flushed by a single vectored write (IOV_MAX is at least 16, usually 1024)
+#define WRITE_GATHER_MAX_CHUNKS 64
+
+/// How the queued data of a socket is written
+enum class SocketWriteMode : uint8
+{
+    Reactor,        // wait for writability, then write synchronously from the network thread
+    Completion      // hand the queued data to an asynchronous write, the only mode IOCP supports
+};
+
+/// Process wide socket write settings, set before the network threads start
+class WH_SHARED_API SocketWriteOptions
+{
+public:
+    /// Completion for the IOCP and io_uring backends, Reactor for epoll/kqueue/select
+    static SocketWriteMode GetDefaultMode();
+
+    static SocketWriteMode GetMode() { return _mode; }
+
+    /// Returns false and keeps the current mode if the I/O backend cannot use the mode
+    static bool SetMode(SocketWriteMode mode);
+
+private:
+    static SocketWriteMode _mode;
+};
+
+/// Write operations of the sockets owned by the calling network thread, reset by whoever reports them
+struct SocketWriteCounters
+{
+    uint64 Writes = 0;
+    uint64 Bytes = 0;
+};
+
+WH_SHARED_API SocketWriteCounters& GetThreadSocketWriteCounters();
+
+/// Chunk of the write queue: either a buffer owned by the queue or a view into a shared payload that owner keeps alive
+class SocketWriteChunk
+{
+public:
+    explicit SocketWriteChunk(MessageBuffer&& buffer) : _buffer(std::move(buffer)), _data(nullptr), _size(0), _sent(0) { }
+
+    SocketWriteChunk(std::shared_ptr<void const> owner, uint8 const* data, std::size_t size) :
+        _buffer(std::size_t(0)), _owner(std::move(owner)), _data(data), _size(size), _sent(0) { }
+
+    uint8 const* GetReadPointer() { return _owner ? _data + _sent : _buffer.GetReadPointer(); }
+    [[nodiscard]] std::size_t GetActiveSize() const { return _owner ? _size - _sent : _buffer.GetActiveSize(); }
+
+    void ReadCompleted(std::size_t bytes)
+    {
+        if (_owner)
+            _sent += bytes;
+        else
+            _buffer.ReadCompleted(bytes);
+    }
+
+private:
+    MessageBuffer _buffer;
+    std::shared_ptr<void const> _owner;
+    uint8 const* _data;
+    std::size_t _size;
+    std::size_t _sent;
+};
 
 template<class T>
 class Socket : public std::enable_shared_from_this<T>
 {
 public:
     explicit Socket(tcp::socket&& socket) : _socket(std::move(socket)), _remoteAddress(_socket.remote_endpoint().address()),
-        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _isWritingAsync(false)
+        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _isWritingAsync(false), _flushRequested(false)
     {
         _readBuffer.Resize(READ_BLOCK_SIZE);
     }
@@ -58,7 +120,10 @@ public:
         if (_closed)
             return false;
 
-#ifndef WH_SOCKET_USE_IOCP
+#ifndef BOOST_ASIO_HAS_IOCP
+        if (SocketWriteOptions::GetMode() == SocketWriteMode::Completion)
+            return true;
+
         if (_isWritingAsync || (_writeQueue.empty() && !_closing))
             return true;
 
@@ -69,6 +134,16 @@ public:
         return true;
     }
 
+    /// Called by the owning network thread for sockets that requested it with RequestFlush
+    virtual void Flush()
+    {
+        ClearFlushRequest();
+        Socket::Update();
+    }
+
+    /// Set by the network thread before the socket is published to other threads, so it is never changed while read
+    void SetFlushNotifier(std::function<void(std::shared_ptr<T>)> notifier) { _flushNotifier = std::move(notifier); }
+
     boost::asio::ip::address GetRemoteIpAddress() const
     {
         return _remoteAddress;
@@ -103,11 +178,22 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.emplace_back(std::move(buffer));
 
-#ifdef WH_SOCKET_USE_IOCP
-        AsyncProcessQueue();
-#endif
+        if (SocketWriteOptions::GetMode() == SocketWriteMode::Completion)
+            AsyncProcessQueue();
+    }
+
+    /// Queues size bytes at data without copying them, owner must keep them alive and unchanged until sent
+    void QueuePacket(std::shared_ptr<void const> owner, uint8 const* data, std::size_t size)
+    {
+        if (!size)
+            return;
+
+        _writeQueue.emplace_back(std::move(owner), data, size);
+
+        if (SocketWriteOptions::GetMode() == SocketWriteMode::Completion)
+            AsyncProcessQueue();
     }
 
     bool IsOpen() const { return !_closed && !_closing; }
@@ -136,6 +222,18 @@ protected:
     virtual void OnClose() { }
     virtual void ReadHandler() = 0;
 
+    /// Wakes the owning network thread to flush this socket, requests made before the flush runs are coalesced into one
+    void RequestFlush()
+    {
+        if (!_flushNotifier || _flushRequested.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        _flushNotifier(this->shared_from_this());
+    }
+
+    /// Must be called before the queued data is collected, so data queued during the flush requests another one
+    void ClearFlushRequest() { _flushRequested.store(false, std::memory_order_release); }
+
     bool AsyncProcessQueue()
     {
         if (_isWritingAsync)
@@ -143,15 +241,19 @@ protected:
 
         _isWritingAsync = true;
 
-#ifdef WH_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
-            this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
-#else
-        _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
-            this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
+#ifndef BOOST_ASIO_HAS_IOCP
+        if (SocketWriteOptions::GetMode() == SocketWriteMode::Reactor)
+        {
+            _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
+                this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
+            return false;
+        }
 #endif
 
+        GatherWriteQueue();
+        _socket.async_write_some(_writeGather, std::bind(&Socket<T>::WriteHandler,
+            this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
+
         return false;
     }
 
@@ -178,17 +280,49 @@ private:
         ReadHandler();
     }
 
-#ifdef WH_SOCKET_USE_IOCP
+    /// Collects the front of the write queue into _writeGather, returns the number of bytes gathered
+    std::size_t GatherWriteQueue()
+    {
+        std::size_t bytes = 0;
+        _writeGather.clear();
+
+        for (SocketWriteChunk& chunk : _writeQueue)
+        {
+            if (_writeGather.size() >= WRITE_GATHER_MAX_CHUNKS)
+                break;
+
+            _writeGather.emplace_back(chunk.GetReadPointer(), chunk.GetActiveSize());
+            bytes += chunk.GetActiveSize();
+        }
+
+        return bytes;
+    }
+
+    /// Drops fully written chunks from the write queue and advances the partially written one
+    void ConsumeWriteQueue(std::size_t bytes)
+    {
+        while (bytes && !_writeQueue.empty())
+        {
+            SocketWriteChunk& chunk = _writeQueue.front();
+            std::size_t chunkBytes = std::min(bytes, chunk.GetActiveSize());
+            chunk.ReadCompleted(chunkBytes);
+            bytes -= chunkBytes;
+
+            if (!chunk.GetActiveSize())
+                _writeQueue.pop_front();
+        }
+    }
 
     void WriteHandler(boost::system::error_code error, std::size_t transferedBytes)
     {
         if (!error)
         {
-            _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
+            SocketWriteCounters& counters = GetThreadSocketWriteCounters();
+            ++counters.Writes;
+            counters.Bytes += transferedBytes;
 
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            _isWritingAsync = false;
+            ConsumeWriteQueue(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -199,7 +333,7 @@ private:
             CloseSocket();
     }
 
-#else
+#ifndef BOOST_ASIO_HAS_IOCP
 
     void WriteHandlerWrapper(boost::system::error_code /*error*/, std::size_t /*transferedBytes*/)
     {
@@ -212,19 +346,21 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = GatherWriteQueue();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeGather, error);
+
+        SocketWriteCounters& counters = GetThreadSocketWriteCounters();
+        ++counters.Writes;
+        counters.Bytes += bytesSent;
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
 
@@ -232,7 +368,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
 
@@ -240,11 +376,11 @@ private:
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            ConsumeWriteQueue(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        ConsumeWriteQueue(bytesSent);
         if (_closing && _writeQueue.empty())
             CloseSocket();
 
@@ -259,12 +395,16 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<SocketWriteChunk> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeGather;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
 
     bool _isWritingAsync;
+
+    std::function<void(std::shared_ptr<T>)> _flushNotifier;
+    std::atomic<bool> _flushRequested;
 };
 
 #endif // __SOCKET_H__
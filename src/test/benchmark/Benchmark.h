@@ -0,0 +1,81 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WARHEAD_BENCHMARK_H
+#define WARHEAD_BENCHMARK_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+
+/// Small timing harness for the *Benchmark test suites.
+/// Benchmarks are registered as DISABLED_ tests so the unit test run skips them. They are run by
+/// the "benchmark" ctest, or by hand with
+///     unit_tests --gtest_also_run_disabled_tests --gtest_filter=*Benchmark.*
+/// The results are printed and recorded as test properties (--gtest_output=xml).
+namespace Warhead::Benchmark
+{
+    /// Runs fn 'runs' times and returns the fastest run, which is the least disturbed by the machine
+    template<typename Fn>
+    Microseconds Measure(uint32 runs, Fn&& fn)
+    {
+        Microseconds best = Microseconds::max();
+
+        for (uint32 i = 0; i < runs; ++i)
+        {
+            auto const start = std::chrono::steady_clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start));
+        }
+
+        return best;
+    }
+
+    /// Keeps the compiler from dropping a computation whose result is otherwise unused
+    template<typename T>
+    void KeepAlive(T const& value)
+    {
+        static T volatile sink{};
+        sink = value;
+    }
+
+    inline void Report(std::string_view name, Microseconds time, uint64 operations = 0)
+    {
+        std::string line = fmt::format("[ BENCH    ] {:<48} {:>10} us", name, time.count());
+        if (operations)
+            line += fmt::format(" {:>10.1f} ns/op", time.count() * 1000.0 / operations);
+
+        fmt::print("{}\n", line);
+        ::testing::Test::RecordProperty(std::string(name), std::to_string(time.count()));
+    }
+
+    /// Reports a baseline and the implementation replacing it, with the speedup of the latter
+    inline void Compare(std::string_view name, Microseconds baseline, Microseconds candidate, uint64 operations = 0)
+    {
+        Report(fmt::format("{} (baseline)", name), baseline, operations);
+        Report(name, candidate, operations);
+        fmt::print("[ BENCH    ] {:<48} {:>10.2f} x\n", fmt::format("{} speedup", name), candidate.count() ? double(baseline.count()) / candidate.count() : 0.0);
+    }
+}
+
+#endif
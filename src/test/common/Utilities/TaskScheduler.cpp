@@ -0,0 +1,99 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(TaskSchedulerTest, RunsTasksInEndOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<uint32> order;
+
+    scheduler.Schedule(30ms, [&](TaskContext) { order.push_back(3); });
+    scheduler.Schedule(10ms, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(20ms, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(20ms, [&](TaskContext) { order.push_back(4); });
+
+    scheduler.Update(19ms);
+    EXPECT_EQ(order, std::vector<uint32>({ 1 }));
+
+    scheduler.Update(11ms);
+    EXPECT_EQ(order, std::vector<uint32>({ 1, 2, 4, 3 }));
+}
+
+TEST(TaskSchedulerTest, RepeatAndCancelGroup)
+{
+    TaskScheduler scheduler;
+    uint32 repeated = 0;
+    bool cancelled = false;
+
+    scheduler.Schedule(10ms, [&](TaskContext context)
+    {
+        if (++repeated == 3)
+            context.CancelGroup(1);
+        else
+            context.Repeat();
+    });
+    scheduler.Schedule(50ms, 1, [&](TaskContext) { cancelled = true; });
+
+    for (uint32 i = 0; i < 10; ++i)
+        scheduler.Update(10ms);
+
+    EXPECT_EQ(repeated, 3u);
+    EXPECT_FALSE(cancelled);
+    EXPECT_FALSE(scheduler.IsGroupScheduled(1));
+}
+
+TEST(TaskSchedulerTest, DelayAndRescheduleGroup)
+{
+    TaskScheduler scheduler;
+    std::vector<uint32> order;
+
+    scheduler.Schedule(10ms, 1, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(10ms, 2, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(20ms, 2, [&](TaskContext) { order.push_back(3); });
+
+    scheduler.DelayGroup(1, 100ms);
+    scheduler.Update(50ms);
+    EXPECT_EQ(order, std::vector<uint32>({ 2, 3 }));
+
+    scheduler.RescheduleGroup(1, 5ms);
+    scheduler.Update(5ms);
+    EXPECT_EQ(order, std::vector<uint32>({ 2, 3, 1 }));
+}
+
+TEST(TaskSchedulerTest, ValidatorStopsDispatching)
+{
+    bool allowed = true;
+    TaskScheduler scheduler([&allowed]() { return allowed; });
+    uint32 executed = 0;
+
+    scheduler.Schedule(10ms, [&](TaskContext) { ++executed; allowed = false; });
+    scheduler.Schedule(10ms, [&](TaskContext) { ++executed; });
+
+    scheduler.Update(10ms);
+    EXPECT_EQ(executed, 1u);
+
+    allowed = true;
+    scheduler.Update(0ms);
+    EXPECT_EQ(executed, 2u);
+}
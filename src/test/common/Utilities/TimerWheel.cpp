@@ -0,0 +1,120 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimerWheel.h"
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+typedef std::vector<std::pair<uint32, uint64>> FiredList;
+
+TEST(TimerWheelTest, FiresInExpiryOrder)
+{
+    TimerWheel<uint32> wheel;
+    FiredList fired;
+
+    // enough entries to leave the sorted list and use the wheel levels
+    for (uint32 i = 0; i < 100; ++i)
+        wheel.Schedule(i, (i * 7919) % 300000 + 1);
+
+    wheel.Advance(300000, [&](uint32 value, uint64 expiry) { fired.emplace_back(value, expiry); });
+
+    ASSERT_EQ(fired.size(), 100u);
+    EXPECT_TRUE(wheel.Empty());
+    for (std::size_t i = 1; i < fired.size(); ++i)
+        EXPECT_LE(fired[i - 1].second, fired[i].second);
+}
+
+TEST(TimerWheelTest, SameExpiryKeepsSchedulingOrder)
+{
+    TimerWheel<uint32> wheel;
+    FiredList fired;
+
+    for (uint32 i = 0; i < 50; ++i)
+        wheel.Schedule(i, 100);
+
+    wheel.Advance(99, [&](uint32 value, uint64 expiry) { fired.emplace_back(value, expiry); });
+    EXPECT_TRUE(fired.empty());
+
+    wheel.Advance(100, [&](uint32 value, uint64 expiry) { fired.emplace_back(value, expiry); });
+    ASSERT_EQ(fired.size(), 50u);
+    for (uint32 i = 0; i < 50; ++i)
+        EXPECT_EQ(fired[i].first, i);
+}
+
+TEST(TimerWheelTest, CancelAndReschedule)
+{
+    TimerWheel<uint32> wheel;
+    FiredList fired;
+
+    auto* cancelled = wheel.Schedule(1, 10);
+    auto* moved = wheel.Schedule(2, 20);
+    wheel.Schedule(3, 15);
+
+    wheel.Cancel(cancelled);
+    wheel.Reschedule(moved, 5);
+    EXPECT_EQ(wheel.Size(), 2u);
+
+    wheel.Advance(20, [&](uint32 value, uint64 expiry) { fired.emplace_back(value, expiry); });
+    ASSERT_EQ(fired.size(), 2u);
+    EXPECT_EQ(fired[0], std::make_pair(2u, uint64(5)));
+    EXPECT_EQ(fired[1], std::make_pair(3u, uint64(15)));
+}
+
+TEST(TimerWheelTest, CallbackMayScheduleExpiredEntries)
+{
+    TimerWheel<uint32> wheel;
+    FiredList fired;
+
+    wheel.Schedule(1, 10);
+    wheel.Advance(50, [&](uint32 value, uint64 expiry)
+    {
+        fired.emplace_back(value, expiry);
+        if (value == 1)
+            wheel.Schedule(2, 30);
+    });
+
+    ASSERT_EQ(fired.size(), 2u);
+    EXPECT_EQ(fired[1], std::make_pair(2u, uint64(30)));
+}
+
+TEST(TimerWheelTest, SpillsAgainAfterMerge)
+{
+    TimerWheel<uint32> wheel;
+    FiredList fired;
+    auto collect = [&](uint32 value, uint64 expiry) { fired.emplace_back(value, expiry); };
+
+    // past the sorted list limit, then drained below the merge limit, which frees the wheel slots
+    for (uint32 i = 0; i < 40; ++i)
+        wheel.Schedule(i, 100 + i);
+
+    wheel.Advance(135, collect);
+    EXPECT_EQ(fired.size(), 36u);
+    EXPECT_EQ(wheel.Size(), 4u);
+
+    // and spilled into newly allocated slots again
+    for (uint32 i = 40; i < 100; ++i)
+        wheel.Schedule(i, 5000 - i);
+
+    wheel.Advance(10000, collect);
+
+    ASSERT_EQ(fired.size(), 100u);
+    EXPECT_TRUE(wheel.Empty());
+    for (std::size_t i = 1; i < fired.size(); ++i)
+        EXPECT_LE(fired[i - 1].second, fired[i].second);
+}
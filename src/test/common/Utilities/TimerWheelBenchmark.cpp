@@ -0,0 +1,124 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Benchmark.h"
+#include "TimerWheel.h"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Queues which fire their events and schedule them again, the way boss scripts and units repeat their spells.
+    // The baseline is the std::multimap the event queues used before the wheel.
+    struct Load
+    {
+        uint32 Queues;
+        uint32 Events;
+        uint32 MinRepeat;
+        uint32 MaxRepeat;
+        uint32 Ticks;
+        uint32 TickTime;
+    };
+
+    uint64 RunMultimap(Load const& load)
+    {
+        std::mt19937 rng(1);
+        std::vector<std::multimap<uint64, uint32>> queues(load.Queues);
+        uint64 fired = 0;
+
+        for (auto& queue : queues)
+            for (uint32 i = 0; i < load.Events; ++i)
+                queue.emplace(load.MinRepeat + rng() % (load.MaxRepeat - load.MinRepeat), i);
+
+        for (uint64 now = load.TickTime; now <= uint64(load.Ticks) * load.TickTime; now += load.TickTime)
+        {
+            for (auto& queue : queues)
+            {
+                while (!queue.empty() && queue.begin()->first <= now)
+                {
+                    uint32 const event = queue.begin()->second;
+                    queue.erase(queue.begin());
+                    queue.emplace(now + load.MinRepeat + rng() % (load.MaxRepeat - load.MinRepeat), event);
+                    ++fired;
+                }
+            }
+        }
+
+        return fired;
+    }
+
+    uint64 RunWheel(Load const& load)
+    {
+        std::mt19937 rng(1);
+        std::vector<std::unique_ptr<TimerWheel<uint32>>> queues;
+        uint64 fired = 0;
+
+        for (uint32 i = 0; i < load.Queues; ++i)
+        {
+            auto& queue = queues.emplace_back(std::make_unique<TimerWheel<uint32>>());
+            for (uint32 j = 0; j < load.Events; ++j)
+                queue->Schedule(j, load.MinRepeat + rng() % (load.MaxRepeat - load.MinRepeat));
+        }
+
+        for (uint64 now = load.TickTime; now <= uint64(load.Ticks) * load.TickTime; now += load.TickTime)
+        {
+            for (auto& queue : queues)
+            {
+                queue->Advance(now, [&](uint32 event, uint64)
+                {
+                    queue->Schedule(event, now + load.MinRepeat + rng() % (load.MaxRepeat - load.MinRepeat));
+                    ++fired;
+                });
+            }
+        }
+
+        return fired;
+    }
+
+    void Compare(char const* name, Load const& load)
+    {
+        uint64 baselineFired = 0, fired = 0;
+        auto const baseline = Warhead::Benchmark::Measure(3, [&]() { baselineFired = RunMultimap(load); });
+        auto const wheel = Warhead::Benchmark::Measure(3, [&]() { fired = RunWheel(load); });
+
+        EXPECT_EQ(baselineFired, fired);
+        Warhead::Benchmark::Compare(name, baseline, wheel, fired);
+    }
+}
+
+// One raid: 25 boss and trash scripts with 15 spells each, repeating every 5 to 30 seconds, 10 minutes of 50 ms map ticks
+TEST(TimerWheelBenchmark, DISABLED_RaidBossEvents)
+{
+    Compare("TimerWheel raid boss events", { 25, 15, 5000, 30000, 12000, 50 });
+}
+
+// Units with a few short events each (auras, spell casts), the common EventProcessor load
+TEST(TimerWheelBenchmark, DISABLED_UnitEvents)
+{
+    Compare("TimerWheel unit events", { 2000, 4, 1000, 10000, 2000, 50 });
+}
+
+// Few queues with many events, e.g. a map wide processor or a busy script
+TEST(TimerWheelBenchmark, DISABLED_LargeQueues)
+{
+    Compare("TimerWheel large queues", { 20, 2000, 5000, 30000, 2000, 50 });
+}
@@ -0,0 +1,150 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DBUpdater.h"
+#include "Util.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+TEST(DBUpdaterTest, SplitStatements)
+{
+    auto statements = DBUpdaterUtil::SplitStatements(
+        "-- comment; not a statement\n"
+        "DELETE FROM `creature` WHERE `guid` = 1;\n"
+        "INSERT INTO `npc_text` VALUES (1, 'a;b', \"it\\'s; \\\"quoted\\\"\"); # trailing comment;\n"
+        "/* block; comment */ UPDATE `t;1` SET `a` = 2\n"
+        ";\n"
+        "/*!40101 SET NAMES utf8 */;\n"
+        "-- last comment");
+
+    ASSERT_EQ(statements.size(), 4u);
+    EXPECT_EQ(statements[0], "DELETE FROM `creature` WHERE `guid` = 1");
+    EXPECT_EQ(statements[1], "INSERT INTO `npc_text` VALUES (1, 'a;b', \"it\\'s; \\\"quoted\\\"\")");
+    EXPECT_EQ(statements[2], "UPDATE `t;1` SET `a` = 2");
+    EXPECT_EQ(statements[3], "/*!40101 SET NAMES utf8 */");
+}
+
+TEST(DBUpdaterTest, SplitStatementsDelimiter)
+{
+    auto statements = DBUpdaterUtil::SplitStatements(
+        "DROP PROCEDURE IF EXISTS `test`;\n"
+        "DELIMITER //\n"
+        "CREATE PROCEDURE `test`() BEGIN SELECT 1; SELECT 2; END//\n"
+        "delimiter ;\n"
+        "CALL `test`();");
+
+    ASSERT_EQ(statements.size(), 3u);
+    EXPECT_EQ(statements[0], "DROP PROCEDURE IF EXISTS `test`");
+    EXPECT_EQ(statements[1], "CREATE PROCEDURE `test`() BEGIN SELECT 1; SELECT 2; END");
+    EXPECT_EQ(statements[2], "CALL `test`()");
+}
+
+TEST(DBUpdaterTest, SplitStatementsEmpty)
+{
+    EXPECT_TRUE(DBUpdaterUtil::SplitStatements("").empty());
+    EXPECT_TRUE(DBUpdaterUtil::SplitStatements(" \n-- only a comment\n/* and another */ ;;").empty());
+}
+
+TEST(DBUpdaterTest, DeferIndexes)
+{
+    std::vector<std::string> statements{
+        "CREATE TABLE IF NOT EXISTS `creature` (\n"
+        "  `guid` int unsigned NOT NULL COMMENT 'Global (unique) identifier',\n"
+        "  `id` int unsigned NOT NULL DEFAULT '0',\n"
+        "  `name` varchar(100) NOT NULL DEFAULT ')',\n"
+        "  PRIMARY KEY (`guid`),\n"
+        "  KEY `idx_id` (`id`)\n"
+        ") ENGINE=InnoDB COMMENT='Creature System (spawns)'",
+        "CREATE TABLE `no_index` (`a` int, PRIMARY KEY (`a`)) COMMENT='(a)'",
+        "INSERT INTO `creature` VALUES (1, 2, 'a')"
+    };
+
+    DBUpdaterUtil::DeferIndexes(statements);
+
+    ASSERT_EQ(statements.size(), 4u);
+    EXPECT_EQ(statements[0],
+        "CREATE TABLE IF NOT EXISTS `creature` (\n"
+        "  `guid` int unsigned NOT NULL COMMENT 'Global (unique) identifier',\n"
+        "  `id` int unsigned NOT NULL DEFAULT '0',\n"
+        "  `name` varchar(100) NOT NULL DEFAULT ')',\n"
+        "  PRIMARY KEY (`guid`)\n"
+        ") ENGINE=InnoDB COMMENT='Creature System (spawns)'");
+    EXPECT_EQ(statements[1], "CREATE TABLE `no_index` (`a` int, PRIMARY KEY (`a`)) COMMENT='(a)'");
+    EXPECT_EQ(statements[2], "INSERT INTO `creature` VALUES (1, 2, 'a')");
+    EXPECT_EQ(statements[3], "ALTER TABLE `creature` ADD KEY `idx_id` (`id`)");
+}
+
+namespace
+{
+    // Statements of the update and base files start with one of these, a statement starting with
+    // anything else is a piece of one that was split in the wrong place
+    constexpr std::array<std::string_view, 17> SQL_KEYWORDS =
+    {
+        "ALTER", "CALL", "CREATE", "DELETE", "DROP", "INSERT", "LOCK", "REPLACE", "SELECT",
+        "SET", "START", "COMMIT", "TRUNCATE", "UNLOCK", "UPDATE", "RENAME", "/*!"
+    };
+
+    bool StartsWithKeyword(std::string const& statement)
+    {
+        return std::any_of(SQL_KEYWORDS.begin(), SQL_KEYWORDS.end(), [&](std::string_view keyword)
+        {
+            return StringStartsWithI(statement, keyword);
+        });
+    }
+}
+
+// Every file DBUpdater applies from the sql tree (_SQL_DIR, see src/test/CMakeLists.txt)
+TEST(DBUpdaterTest, SplitStatementsSqlTree)
+{
+    std::size_t files = 0;
+    std::size_t statements = 0;
+
+    for (std::string_view directory : { "base", "updates", "custom" })
+    {
+        for (auto const& entry : std::filesystem::recursive_directory_iterator(std::filesystem::path(_SQL_DIR) / directory))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".sql")
+                continue;
+
+            std::ifstream in(entry.path(), std::ios::binary);
+            std::stringstream sql;
+            sql << in.rdbuf();
+
+            for (std::string const& statement : DBUpdaterUtil::SplitStatements(sql.str()))
+            {
+                ++statements;
+
+                ASSERT_FALSE(statement.empty()) << entry.path();
+                EXPECT_FALSE(std::isspace(static_cast<unsigned char>(statement.front())) || std::isspace(static_cast<unsigned char>(statement.back()))) << entry.path() << ": " << statement.substr(0, 80);
+                EXPECT_TRUE(StartsWithKeyword(statement)) << entry.path() << ": " << statement.substr(0, 80);
+                EXPECT_FALSE(StringStartsWithI(statement, "DELIMITER")) << entry.path();
+            }
+
+            ++files;
+        }
+    }
+
+    EXPECT_GT(files, 0u);
+    EXPECT_GT(statements, files);
+}
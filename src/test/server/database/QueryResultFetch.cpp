@@ -0,0 +1,131 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Optional.h"
+#include "QueryResultFetch.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    QueryResultFieldMetadata MakeField(std::string name, DatabaseFieldTypes type)
+    {
+        QueryResultFieldMetadata meta;
+        meta.Name = name;
+        meta.Alias = std::move(name);
+        meta.Type = type;
+        return meta;
+    }
+
+    void AppendValue(std::string& data, Optional<std::string_view> value)
+    {
+        uint32 length = value ? uint32(value->size()) : ResultSetRows::NullValue;
+        data.append(reinterpret_cast<char const*>(&length), sizeof(length));
+
+        if (!value)
+            return;
+
+        data.append(*value);
+        data.push_back('\0');
+    }
+
+    std::unique_ptr<ResultSet> MakeResult(std::vector<std::vector<Optional<std::string_view>>> const& rows)
+    {
+        auto data = std::make_shared<std::string>();
+        for (auto const& row : rows)
+            for (auto const& value : row)
+                AppendValue(*data, value);
+
+        ResultSetRows resultRows;
+        resultRows.FieldMetadata.emplace_back(MakeField("guid", DatabaseFieldTypes::Int32));
+        resultRows.FieldMetadata.emplace_back(MakeField("map", DatabaseFieldTypes::Int16));
+        resultRows.FieldMetadata.emplace_back(MakeField("equipment_id", DatabaseFieldTypes::Int8));
+        resultRows.FieldMetadata.emplace_back(MakeField("position_x", DatabaseFieldTypes::Float));
+        resultRows.FieldMetadata.emplace_back(MakeField("ScriptName", DatabaseFieldTypes::Binary));
+        resultRows.Data = *data;
+        resultRows.RowCount = rows.size();
+        resultRows.Owner = data;
+
+        auto result = std::make_unique<ResultSet>(std::move(resultRows));
+        result->NextRow();
+        return result;
+    }
+
+    struct SpawnRow
+    {
+        uint32 Guid{};
+        uint16 Map{};
+        int8 EquipmentId{};
+        float PositionX{};
+        std::string ScriptName;
+    };
+}
+
+TEST(QueryResultFetchTest, FetchRows)
+{
+    auto result = MakeResult({
+        { "12", "571", "-1", "5812.5", "npc_test" },
+        { "4294967295", "0", "0", "-0.25", std::nullopt }
+    });
+
+    auto rows = FetchRows<&SpawnRow::Guid, &SpawnRow::Map, &SpawnRow::EquipmentId, &SpawnRow::PositionX, &SpawnRow::ScriptName>(*result);
+    ASSERT_EQ(rows.size(), 2u);
+
+    EXPECT_EQ(rows[0].Guid, 12u);
+    EXPECT_EQ(rows[0].Map, 571);
+    EXPECT_EQ(rows[0].EquipmentId, -1);
+    EXPECT_FLOAT_EQ(rows[0].PositionX, 5812.5f);
+    EXPECT_EQ(rows[0].ScriptName, "npc_test");
+
+    EXPECT_EQ(rows[1].Guid, 4294967295u);
+    EXPECT_EQ(rows[1].Map, 0);
+    EXPECT_EQ(rows[1].EquipmentId, 0);
+    EXPECT_FLOAT_EQ(rows[1].PositionX, -0.25f);
+    EXPECT_TRUE(rows[1].ScriptName.empty());
+}
+
+TEST(QueryResultFetchTest, FetchColumns)
+{
+    auto result = MakeResult({
+        { "1", "0", "1", "1.5", "a" },
+        { "2", "1", "0", "2.5", "b" },
+        { "3", "-1", std::nullopt, "3.5", "" }
+    });
+
+    auto [guids, maps, equipment, positions, scripts] = FetchColumns<uint32, uint16, bool, double, std::string>(*result);
+
+    EXPECT_EQ(guids, (std::vector<uint32>{ 1, 2, 3 }));
+    EXPECT_EQ(maps, (std::vector<uint16>{ 0, 1, 65535 }));
+    EXPECT_EQ(equipment, (std::vector<bool>{ true, false, false }));
+    EXPECT_EQ(positions, (std::vector<double>{ 1.5, 2.5, 3.5 }));
+    EXPECT_EQ(scripts, (std::vector<std::string>{ "a", "b", "" }));
+}
+
+TEST(QueryResultFetchTest, PartialValues)
+{
+    auto result = MakeResult({
+        { "12abc", "1.5", "1 ", "2.5x", "a" },
+        { "7", "3", "-1", "1e3", "b" }
+    });
+
+    auto [guids, maps, equipment, positions, scripts] = FetchColumns<uint32, uint16, int8, float, std::string>(*result);
+
+    EXPECT_EQ(guids, (std::vector<uint32>{ 0, 7 }));
+    EXPECT_EQ(maps, (std::vector<uint16>{ 0, 3 }));
+    EXPECT_EQ(equipment, (std::vector<int8>{ 0, -1 }));
+    EXPECT_EQ(positions, (std::vector<float>{ 0.0f, 1000.0f }));
+}
@@ -0,0 +1,173 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "QueryResultFetch.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Text protocol rows shaped like the creature spawn table, decoded row by row with Field::Get
+    // the way the loaders did before, and with FetchRows
+    struct SpawnRow
+    {
+        uint32 Guid{};
+        uint32 Id{};
+        uint16 Map{};
+        uint8 SpawnMask{};
+        float PositionX{};
+        float PositionY{};
+        float PositionZ{};
+        float Orientation{};
+        uint32 SpawnTime{};
+        std::string ScriptName;
+    };
+
+    QueryResultFieldMetadata MakeField(std::string name, DatabaseFieldTypes type)
+    {
+        QueryResultFieldMetadata meta;
+        meta.Name = name;
+        meta.Alias = std::move(name);
+        meta.Type = type;
+        return meta;
+    }
+
+    void AppendValue(std::string& data, std::string const& value)
+    {
+        uint32 length = uint32(value.size());
+        data.append(reinterpret_cast<char const*>(&length), sizeof(length));
+        data.append(value);
+        data.push_back('\0');
+    }
+
+    ResultSetRows MakeRows(uint32 count)
+    {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(-10000.0f, 10000.0f);
+        auto data = std::make_shared<std::string>();
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            AppendValue(*data, std::to_string(i + 1));
+            AppendValue(*data, std::to_string(rng() % 40000));
+            AppendValue(*data, std::to_string(rng() % 800));
+            AppendValue(*data, std::to_string(1 + rng() % 15));
+            AppendValue(*data, std::to_string(position(rng)));
+            AppendValue(*data, std::to_string(position(rng)));
+            AppendValue(*data, std::to_string(position(rng) / 100.0f));
+            AppendValue(*data, std::to_string(position(rng) / 10000.0f));
+            AppendValue(*data, std::to_string(rng() % 86400));
+            AppendValue(*data, rng() % 8 ? "" : "npc_benchmark_script");
+        }
+
+        ResultSetRows rows;
+        rows.FieldMetadata.emplace_back(MakeField("guid", DatabaseFieldTypes::Int32));
+        rows.FieldMetadata.emplace_back(MakeField("id", DatabaseFieldTypes::Int32));
+        rows.FieldMetadata.emplace_back(MakeField("map", DatabaseFieldTypes::Int16));
+        rows.FieldMetadata.emplace_back(MakeField("spawnMask", DatabaseFieldTypes::Int8));
+        rows.FieldMetadata.emplace_back(MakeField("position_x", DatabaseFieldTypes::Float));
+        rows.FieldMetadata.emplace_back(MakeField("position_y", DatabaseFieldTypes::Float));
+        rows.FieldMetadata.emplace_back(MakeField("position_z", DatabaseFieldTypes::Float));
+        rows.FieldMetadata.emplace_back(MakeField("orientation", DatabaseFieldTypes::Float));
+        rows.FieldMetadata.emplace_back(MakeField("spawntimesecs", DatabaseFieldTypes::Int32));
+        rows.FieldMetadata.emplace_back(MakeField("ScriptName", DatabaseFieldTypes::Binary));
+        rows.Data = *data;
+        rows.RowCount = count;
+        rows.Owner = data;
+        return rows;
+    }
+
+    std::vector<SpawnRow> FetchWithGet(ResultSet& result)
+    {
+        std::vector<SpawnRow> rows;
+        rows.reserve(result.GetRowCount());
+
+        do
+        {
+            Field* fields = result.Fetch();
+            SpawnRow& row = rows.emplace_back();
+            row.Guid = fields[0].Get<uint32>();
+            row.Id = fields[1].Get<uint32>();
+            row.Map = fields[2].Get<uint16>();
+            row.SpawnMask = fields[3].Get<uint8>();
+            row.PositionX = fields[4].Get<float>();
+            row.PositionY = fields[5].Get<float>();
+            row.PositionZ = fields[6].Get<float>();
+            row.Orientation = fields[7].Get<float>();
+            row.SpawnTime = fields[8].Get<uint32>();
+            row.ScriptName = fields[9].Get<std::string>();
+        } while (result.NextRow());
+
+        return rows;
+    }
+
+    std::vector<SpawnRow> FetchWithRows(ResultSet& result)
+    {
+        return FetchRows<&SpawnRow::Guid, &SpawnRow::Id, &SpawnRow::Map, &SpawnRow::SpawnMask, &SpawnRow::PositionX, &SpawnRow::PositionY,
+            &SpawnRow::PositionZ, &SpawnRow::Orientation, &SpawnRow::SpawnTime, &SpawnRow::ScriptName>(result);
+    }
+
+    template<typename Fetch>
+    std::vector<SpawnRow> Run(ResultSetRows const& rows, uint32 results, Fetch fetch)
+    {
+        std::vector<SpawnRow> fetched;
+        for (uint32 i = 0; i < results; ++i)
+        {
+            ResultSet result(rows);
+            result.NextRow();
+            fetched = fetch(result);
+        }
+
+        return fetched;
+    }
+
+    void Compare(char const* name, uint32 count, uint32 results)
+    {
+        ResultSetRows const rows = MakeRows(count);
+        std::vector<SpawnRow> baselineRows, fetchedRows;
+
+        auto const baseline = Warhead::Benchmark::Measure(5, [&]() { baselineRows = Run(rows, results, &FetchWithGet); });
+        auto const fetched = Warhead::Benchmark::Measure(5, [&]() { fetchedRows = Run(rows, results, &FetchWithRows); });
+
+        ASSERT_EQ(baselineRows.size(), fetchedRows.size());
+        for (std::size_t i = 0; i < fetchedRows.size(); ++i)
+        {
+            EXPECT_EQ(baselineRows[i].Guid, fetchedRows[i].Guid);
+            EXPECT_EQ(baselineRows[i].PositionX, fetchedRows[i].PositionX);
+            EXPECT_EQ(baselineRows[i].ScriptName, fetchedRows[i].ScriptName);
+        }
+
+        Warhead::Benchmark::Compare(name, baseline, fetched, uint64(count) * results);
+    }
+}
+
+// A loader of the size of the creature table
+TEST(QueryResultFetchBenchmark, DISABLED_CreatureSpawns)
+{
+    Compare("FetchRows creature spawns", 150000, 1);
+}
+
+// Small results, where the decoders picked per column are a larger part of the work
+TEST(QueryResultFetchBenchmark, DISABLED_SmallResults)
+{
+    Compare("FetchRows small results", 20, 10000);
+}
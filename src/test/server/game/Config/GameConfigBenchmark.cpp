@@ -0,0 +1,151 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "Config.h"
+#include "GameConfig.h"
+#include "StringConvert.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 OPTIONS = 300;
+    constexpr uint32 LOOKUPS = 1000000;
+
+    std::string GetOptionName(uint32 index)
+    {
+        return "Benchmark.GameConfig.Option" + std::to_string(index);
+    }
+
+    // The lookup GameConfig had before the option handles: a string-keyed map of the raw
+    // values, a std::string built from the name and the value parsed on every call
+    struct LegacyGameConfig
+    {
+        std::unordered_map<std::string, std::string> Options;
+
+        template<typename T>
+        T GetOption(std::string_view optionName)
+        {
+            std::string option{ optionName };
+
+            auto itr = Options.find(option);
+            if (itr == Options.end())
+                return T();
+
+            return Warhead::StringTo<T>(itr->second).value_or(T());
+        }
+    };
+
+    // Writes the options to a config file, so GameConfig reads them like worldserver.conf.dist
+    class GameConfigBenchmark : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            _confFilePath = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme.ini")).native();
+
+            std::ofstream iniStream(_confFilePath + ".dist");
+            iniStream << "[test]\n";
+            for (uint32 i = 0; i < OPTIONS; ++i)
+            {
+                std::string const value = std::to_string(i % 2 ? i : i * 1000);
+                iniStream << GetOptionName(i) << " = " << value << "\n";
+                _legacy.Options.emplace(GetOptionName(i), value);
+                _names.push_back(GetOptionName(i));
+            }
+
+            iniStream.close();
+
+            sConfigMgr->Configure(_confFilePath, std::vector<std::string>());
+            sConfigMgr->LoadAppConfigs();
+        }
+
+        void TearDown() override
+        {
+            std::remove((_confFilePath + ".dist").c_str());
+        }
+
+        std::string _confFilePath;
+        std::vector<std::string> _names;
+        LegacyGameConfig _legacy;
+    };
+}
+
+// CONF_GET_* with a string literal, the common case: the handle is resolved once per call site
+TEST_F(GameConfigBenchmark, DISABLED_ResolvedOptions)
+{
+    std::vector<GameConfig::OptionHandle> handles;
+    for (std::string const& name : _names)
+        handles.push_back(sGameConfig->GetHandle<uint32>(name));
+
+    for (uint32 i = 0; i < OPTIONS; ++i)
+        ASSERT_EQ(sGameConfig->GetOption<uint32>(handles[i]), _legacy.GetOption<uint32>(_names[i]));
+
+    Microseconds const legacy = Warhead::Benchmark::Measure(5, [&]()
+    {
+        uint64 sum = 0;
+        for (uint32 i = 0; i < LOOKUPS; ++i)
+            sum += _legacy.GetOption<uint32>(_names[i % OPTIONS]);
+
+        Warhead::Benchmark::KeepAlive(sum);
+    });
+
+    Microseconds const resolved = Warhead::Benchmark::Measure(5, [&]()
+    {
+        uint64 sum = 0;
+        for (uint32 i = 0; i < LOOKUPS; ++i)
+            sum += sGameConfig->GetOption<uint32>(handles[i % OPTIONS]);
+
+        Warhead::Benchmark::KeepAlive(sum);
+    });
+
+    Warhead::Benchmark::Compare("GameConfig uint32 by handle", legacy, resolved, LOOKUPS);
+}
+
+// CONF_GET_* with a name built at runtime, looked up on every call
+TEST_F(GameConfigBenchmark, DISABLED_OptionsByName)
+{
+    for (uint32 i = 0; i < OPTIONS; ++i)
+        ASSERT_EQ(sGameConfig->GetOption<float>(_names[i]), _legacy.GetOption<float>(_names[i]));
+
+    Microseconds const legacy = Warhead::Benchmark::Measure(5, [&]()
+    {
+        float sum = 0.0f;
+        for (uint32 i = 0; i < LOOKUPS; ++i)
+            sum += _legacy.GetOption<float>(_names[i % OPTIONS]);
+
+        Warhead::Benchmark::KeepAlive(sum);
+    });
+
+    Microseconds const byName = Warhead::Benchmark::Measure(5, [&]()
+    {
+        float sum = 0.0f;
+        for (uint32 i = 0; i < LOOKUPS; ++i)
+            sum += sGameConfig->GetOption<float>(_names[i % OPTIONS]);
+
+        Warhead::Benchmark::KeepAlive(sum);
+    });
+
+    Warhead::Benchmark::Compare("GameConfig float by name", legacy, byName, LOOKUPS);
+}
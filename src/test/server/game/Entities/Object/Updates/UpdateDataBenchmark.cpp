@@ -0,0 +1,181 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "Config.h"
+#include "GameConfig.h"
+#include "Opcodes.h"
+#include "UpdateData.h"
+#include "WorldPacket.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <vector>
+#include <zlib.h>
+
+namespace
+{
+    constexpr uint32 PACKETS = 2000;
+
+    // UpdateData::Compress before the compressor was kept per thread: a new stream for every
+    // packet, always at the configured level
+    void LegacyCompress(void* dst, uint32* dst_size, void* src, int src_size, int level)
+    {
+        z_stream c_stream;
+        c_stream.zalloc = (alloc_func)0;
+        c_stream.zfree = (free_func)0;
+        c_stream.opaque = (voidpf)0;
+
+        if (deflateInit(&c_stream, level) != Z_OK)
+        {
+            *dst_size = 0;
+            return;
+        }
+
+        c_stream.next_out = (Bytef*)dst;
+        c_stream.avail_out = *dst_size;
+        c_stream.next_in = (Bytef*)src;
+        c_stream.avail_in = (uInt)src_size;
+
+        if (deflate(&c_stream, Z_NO_FLUSH) != Z_OK || c_stream.avail_in != 0 || deflate(&c_stream, Z_FINISH) != Z_STREAM_END)
+        {
+            deflateEnd(&c_stream);
+            *dst_size = 0;
+            return;
+        }
+
+        *dst_size = c_stream.total_out;
+        deflateEnd(&c_stream);
+    }
+
+    // UpdateData::BuildPacket with LegacyCompress
+    void LegacyBuildPacket(ByteBuffer const& data, WorldPacket* packet, int level)
+    {
+        ByteBuffer buf(4 + data.wpos());
+        buf << uint32(1);
+        buf.append(data);
+
+        uint32 destsize = compressBound(buf.wpos());
+        packet->resize(destsize + sizeof(uint32));
+        packet->put<uint32>(0, buf.wpos());
+        LegacyCompress(const_cast<uint8*>(packet->contents()) + sizeof(uint32), &destsize, (void*)buf.contents(), buf.wpos(), level);
+        packet->resize(destsize + sizeof(uint32));
+        packet->SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    }
+
+    // Update blocks look like object fields: packed guids, small counters, flags and coordinates
+    std::vector<ByteBuffer> MakeBlocks(uint32 size)
+    {
+        std::mt19937 rng(3);
+        std::vector<ByteBuffer> blocks(PACKETS);
+
+        for (ByteBuffer& block : blocks)
+        {
+            while (block.wpos() < size)
+            {
+                block << uint8(UPDATETYPE_VALUES);
+                block << uint8(0xFF) << uint64(0xF130000000000000ull | (rng() & 0xFFFFFF));
+                block << uint32(rng() % 100) << uint32(rng() & 0x00FF00FF) << float(rng() % 10000) / 3.0f;
+            }
+        }
+
+        return blocks;
+    }
+
+    // Compression is read from a generated config file, like worldserver.conf.dist
+    class UpdateDataBenchmark : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            _confFilePath = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme.ini")).native();
+
+            std::ofstream iniStream(_confFilePath + ".dist");
+            iniStream << "[test]\nCompression = 1\n";
+            iniStream.close();
+
+            sConfigMgr->Configure(_confFilePath, std::vector<std::string>());
+            sConfigMgr->LoadAppConfigs();
+            sGameConfig->GetHandle<int32>("Compression");
+        }
+
+        void TearDown() override
+        {
+            UpdateData::SetAverageWorldUpdateTime(0);
+            std::remove((_confFilePath + ".dist").c_str());
+        }
+
+        // Builds every packet both ways and reports the times and the compressed sizes
+        static void Compare(std::string_view name, uint32 size, int level, uint32 worldUpdateTime)
+        {
+            sGameConfig->SetOption<int32>("Compression", level);
+            UpdateData::SetAverageWorldUpdateTime(worldUpdateTime);
+
+            std::vector<ByteBuffer> const blocks = MakeBlocks(size);
+            uint64 legacySize = 0;
+            uint64 currentSize = 0;
+
+            Microseconds const legacy = Warhead::Benchmark::Measure(5, [&]()
+            {
+                legacySize = 0;
+                for (ByteBuffer const& block : blocks)
+                {
+                    WorldPacket packet;
+                    LegacyBuildPacket(block, &packet, level);
+                    legacySize += packet.size();
+                }
+            });
+
+            Microseconds const current = Warhead::Benchmark::Measure(5, [&]()
+            {
+                currentSize = 0;
+                for (ByteBuffer const& block : blocks)
+                {
+                    UpdateData data;
+                    data.AddUpdateBlock(block);
+
+                    WorldPacket packet;
+                    ASSERT_TRUE(data.BuildPacket(&packet));
+                    ASSERT_EQ(packet.GetOpcode(), SMSG_COMPRESSED_UPDATE_OBJECT);
+                    currentSize += packet.size();
+                }
+            });
+
+            Warhead::Benchmark::Compare(name, legacy, current, PACKETS);
+            fmt::print("[ BENCH    ] {:<48} {:>10} bytes (baseline) {:>10} bytes\n", fmt::format("{} size", name), legacySize / PACKETS, currentSize / PACKETS);
+        }
+
+        std::string _confFilePath;
+    };
+}
+
+// Most update packets are a few hundred bytes, there the stream setup dominates
+TEST_F(UpdateDataBenchmark, DISABLED_SmallPackets)
+{
+    Compare("UpdateData 200 bytes, level 1", 200, Z_BEST_SPEED, 0);
+    Compare("UpdateData 200 bytes, level 6", 200, 6, 0);
+}
+
+TEST_F(UpdateDataBenchmark, DISABLED_LargePackets)
+{
+    Compare("UpdateData 4KB, level 1", 4096, Z_BEST_SPEED, 0);
+    Compare("UpdateData 4KB, level 6", 4096, 6, 0);
+    Compare("UpdateData 4KB, level 6, loaded world", 4096, 6, 100);
+}
@@ -0,0 +1,368 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WARHEAD_VISIBILITY_CROWD_H
+#define WARHEAD_VISIBILITY_CROWD_H
+
+#include "VisibilityDelta.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Players and creatures moving around one place, with the relocation visibility updates of the
+// world server: players and creatures notify once they moved the required distance, one notify
+// delay later. Player updates are either full, like PlayerRelocationNotifier, or delta updates,
+// like PlayerRelocationDeltaNotifier. Objects can be stealthed and teleported in between, without
+// telling the players around, so the updates have to pick up stale client state on their own.
+class VisibilityCrowd
+{
+public:
+    struct Settings
+    {
+        uint32 Players;
+        uint32 Creatures;
+        float Size;             // side of the square the crowd moves in
+        float Range;            // visibility range, object sizes included
+        float ReqMoveDist;
+        float NotifyDelay;      // seconds
+        bool Delta;
+    };
+
+    // A world object is several kilobytes, every object a visibility check looks at costs cache misses
+    struct Object
+    {
+        virtual ~Object() = default;
+        [[nodiscard]] virtual bool IsNeverVisible() const { return false; }
+        [[nodiscard]] virtual bool IsAlwaysVisible() const { return false; }
+
+        Position Pos;
+        std::array<uint8, 1024> Data1{};
+        Position LastNotify;
+        float Speed{};
+        float Heading{};
+        std::array<uint8, 1024> Data2{};
+        float NotifyIn{ -1.0f };        // seconds until the pending notify runs, negative if none
+        uint32 PhaseMask{ 1 };
+        bool IsPlayer{};
+        bool Stealthed{};               // hidden from everybody, like a stealth nobody detects
+        std::unordered_set<uint32> ClientObjects; // players only, like Player::m_clientGUIDs
+
+        [[nodiscard]] bool IsPending() const { return NotifyIn >= 0.0f; }
+    };
+
+    explicit VisibilityCrowd(Settings const& settings) : _settings(settings), _rng(7)
+    {
+        std::uniform_real_distribution<float> coord(0.0f, settings.Size);
+        std::uniform_real_distribution<float> heading(0.0f, 2.0f * float(M_PI));
+
+        for (uint32 i = 0; i < settings.Players + settings.Creatures; ++i)
+        {
+            auto& object = _objects.emplace_back(std::make_unique<Object>());
+            object->Pos.Relocate(coord(_rng), coord(_rng), std::uniform_real_distribution<float>(0.0f, 10.0f)(_rng));
+            object->LastNotify.Relocate(-5000.0f, -5000.0f, -5000.0f);
+            object->Heading = heading(_rng);
+            object->IsPlayer = i < settings.Players;
+
+            // players run, half of the creatures wander and the others stand
+            if (object->IsPlayer)
+                object->Speed = 7.0f;
+            else if (i % 2)
+                object->Speed = 2.5f;
+        }
+
+        IndexCells();
+
+        // everybody starts with a full update, like after entering the map
+        for (uint32 i = 0; i < settings.Players; ++i)
+        {
+            for (uint32 j = 0; j < _objects.size(); ++j)
+                if (i != j && InRange(*_objects[i], *_objects[j]))
+                    _objects[i]->ClientObjects.insert(j);
+
+            _objects[i]->LastNotify.Relocate(_objects[i]->Pos);
+        }
+    }
+
+    // Moves everybody for 'diff' seconds and runs the notifies which are due.
+    // 'check' is called after every player update with the index of the player.
+    template<typename Check>
+    void Update(float diff, Check&& check)
+    {
+        Move(diff);
+
+        for (uint32 i = 0; i < _objects.size(); ++i)
+        {
+            Object& object = *_objects[i];
+
+            if (!object.IsPending())
+            {
+                if (object.Pos.GetExactDistSq(object.LastNotify) >= _settings.ReqMoveDist * _settings.ReqMoveDist)
+                    object.NotifyIn = _settings.NotifyDelay;
+
+                continue;
+            }
+
+            object.NotifyIn -= diff;
+            if (object.NotifyIn >= 0.0f)
+                continue;
+
+            Position const lastNotify = object.LastNotify;
+            object.NotifyIn = -1.0f;
+            object.LastNotify.Relocate(object.Pos);
+
+            if (!object.IsPlayer)
+            {
+                RelocateCreature(i);
+                continue;
+            }
+
+            auto const start = std::chrono::steady_clock::now();
+
+            if (_settings.Delta)
+                RelocatePlayerDelta(i, lastNotify);
+            else
+                RelocatePlayer(i);
+
+            _updateTime += std::chrono::steady_clock::now() - start;
+            ++_updates;
+            check(i);
+        }
+    }
+
+    [[nodiscard]] bool InRange(Object const& viewer, Object const& target) const
+    {
+        return viewer.Pos.GetExactDistSq(target.Pos) < _settings.Range * _settings.Range;
+    }
+
+    // what a full update leaves at the client
+    [[nodiscard]] bool IsVisible(Object const& viewer, Object const& target) const
+    {
+        return !target.Stealthed && InRange(viewer, target);
+    }
+
+    // Stealth starting or ending, the players around only notice on their next update
+    void SetStealthed(uint32 index, bool stealthed)
+    {
+        _objects[index]->Stealthed = stealthed;
+    }
+
+    // Moves an object anywhere, it stops there. Its own relocation notify only reaches the players
+    // around the new position, the ones around the old position only notice on their next update.
+    void Teleport(uint32 index, Position const& pos)
+    {
+        _objects[index]->Pos.Relocate(pos);
+        _objects[index]->Speed = 0.0f;
+        IndexCells();
+    }
+
+    [[nodiscard]] std::vector<std::unique_ptr<Object>> const& GetObjects() const { return _objects; }
+    [[nodiscard]] std::chrono::steady_clock::duration GetUpdateTime() const { return _updateTime; }
+    [[nodiscard]] uint64 GetUpdates() const { return _updates; }
+    [[nodiscard]] uint64 GetChecks() const { return _checks; }
+    [[nodiscard]] uint64 GetFallbacks() const { return _fallbacks; }
+
+private:
+    // search radius of the player updates, visibility range and gameobject bonus
+    [[nodiscard]] float GetSearchRadius() const { return _settings.Range + 30.0f; }
+
+    void Move(float diff)
+    {
+        std::uniform_real_distribution<float> turn(-0.3f, 0.3f);
+
+        for (auto& object : _objects)
+        {
+            if (!object->Speed)
+                continue;
+
+            object->Heading += turn(_rng);
+            float x = object->Pos.GetPositionX() + std::cos(object->Heading) * object->Speed * diff;
+            float y = object->Pos.GetPositionY() + std::sin(object->Heading) * object->Speed * diff;
+
+            // turn around at the border
+            if (x < 0.0f || x > _settings.Size || y < 0.0f || y > _settings.Size)
+            {
+                object->Heading += float(M_PI);
+                x = std::clamp(x, 0.0f, _settings.Size);
+                y = std::clamp(y, 0.0f, _settings.Size);
+            }
+
+            object->Pos.Relocate(x, y, object->Pos.GetPositionZ());
+        }
+
+        IndexCells();
+    }
+
+    void IndexCells()
+    {
+        for (auto& [id, cell] : _cells)
+            cell.clear();
+
+        for (uint32 i = 0; i < _objects.size(); ++i)
+            _cells[Warhead::ComputeCellCoord(_objects[i]->Pos.GetPositionX(), _objects[i]->Pos.GetPositionY()).GetId()].push_back(i);
+    }
+
+    template<typename Visitor>
+    void VisitCells(VisibilityDelta const& delta, Visitor&& visitor) const
+    {
+        CellArea const& area = delta.GetArea();
+        for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+        {
+            for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+            {
+                CellCoord const cellCoord(x, y);
+                if (delta.GetCellChange(cellCoord) == VisibilityDelta::CELL_OUTSIDE)
+                    continue;
+
+                auto itr = _cells.find(cellCoord.GetId());
+                if (itr == _cells.end())
+                    continue;
+
+                for (uint32 index : itr->second)
+                    visitor(index);
+            }
+        }
+    }
+
+    // like WorldObject::CanSeeOrDetect, a few virtual calls and the distance check
+    bool CanSee(Object const& viewer, Object const& target)
+    {
+        ++_checks;
+
+        if (target.IsNeverVisible() || target.Stealthed)
+            return false;
+
+        if (target.IsAlwaysVisible())
+            return true;
+
+        return (viewer.PhaseMask & target.PhaseMask) && InRange(viewer, target);
+    }
+
+    // like Player::UpdateVisibilityOf
+    void UpdateVisibilityOf(uint32 viewer, uint32 target)
+    {
+        Object& object = *_objects[viewer];
+        if (object.ClientObjects.contains(target))
+        {
+            if (!CanSee(object, *_objects[target]))
+                object.ClientObjects.erase(target);
+        }
+        else if (CanSee(object, *_objects[target]))
+            object.ClientObjects.insert(target);
+    }
+
+    // like PlayerRelocationDeltaNotifier::GetDrift
+    [[nodiscard]] float GetDrift(Object const& target) const
+    {
+        if (target.Speed || target.IsPending())
+            return _settings.ReqMoveDist + target.Speed * _settings.NotifyDelay;
+
+        return _settings.ReqMoveDist;
+    }
+
+    // PlayerRelocationNotifier: checks everything around and drops what it did not visit
+    void RelocatePlayer(uint32 player)
+    {
+        Object& object = *_objects[player];
+        std::unordered_set<uint32> notVisited = object.ClientObjects;
+
+        VisitCells(VisibilityDelta(object.Pos, object.Pos, GetSearchRadius()), [&](uint32 target)
+        {
+            if (target == player)
+                return;
+
+            notVisited.erase(target);
+            UpdateVisibilityOf(player, target);
+
+            if (_objects[target]->IsPlayer)
+                UpdateVisibilityOf(target, player);
+        });
+
+        for (uint32 target : notVisited)
+        {
+            object.ClientObjects.erase(target);
+
+            if (_objects[target]->IsPlayer)
+                UpdateVisibilityOf(target, player);
+        }
+    }
+
+    // PlayerRelocationDeltaNotifier: only checks what the move may have changed, stealthed players
+    // and objects at the client outside of the visited cells get the full update, see Unit::ExecuteDelayedUnitRelocationEvent
+    void RelocatePlayerDelta(uint32 player, Position const& lastNotify)
+    {
+        Object& object = *_objects[player];
+        if (object.Stealthed)
+        {
+            RelocatePlayer(player);
+            return;
+        }
+
+        VisibilityDelta const delta(lastNotify, object.Pos, GetSearchRadius());
+        std::size_t clientObjectsFound = 0;
+
+        VisitCells(delta, [&](uint32 target)
+        {
+            if (target == player)
+                return;
+
+            Object const& other = *_objects[target];
+            if (other.Stealthed || delta.NeedsCheck(other.Pos, _settings.Range, GetDrift(other), object.ClientObjects.contains(target)))
+                UpdateVisibilityOf(player, target);
+
+            if (other.IsPlayer && delta.NeedsCheck(other.Pos, _settings.Range, GetDrift(other), other.ClientObjects.contains(player)))
+                UpdateVisibilityOf(target, player);
+
+            clientObjectsFound += object.ClientObjects.contains(target);
+        });
+
+        if (!VisibilityDelta::CoversClient(clientObjectsFound, object.ClientObjects.size()))
+        {
+            ++_fallbacks;
+            RelocatePlayer(player);
+        }
+    }
+
+    // CreatureRelocationNotifier: players which notify themselves soon are left to their own update
+    void RelocateCreature(uint32 creature)
+    {
+        Object const& object = *_objects[creature];
+
+        VisitCells(VisibilityDelta(object.Pos, object.Pos, _settings.Range + 15.0f), [&](uint32 target)
+        {
+            if (_objects[target]->IsPlayer && !_objects[target]->IsPending())
+                UpdateVisibilityOf(target, creature);
+        });
+    }
+
+    Settings _settings;
+    std::mt19937 _rng;
+    std::vector<std::unique_ptr<Object>> _objects;
+    std::unordered_map<uint32, std::vector<uint32>> _cells;
+    std::chrono::steady_clock::duration _updateTime{};
+    uint64 _updates{};
+    uint64 _checks{};
+    uint64 _fallbacks{};
+};
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Benchmark.h"
+#include "VisibilityCrowd.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    // 500 players and 500 creatures for 10 seconds of 50 ms world updates. Only the player
+    // relocation updates are timed, both crowds move the same way.
+    void Compare(char const* name, float size, float reqMoveDist, float notifyDelay)
+    {
+        VisibilityCrowd full({ 500, 500, size, 90.0f, reqMoveDist, notifyDelay, false });
+        VisibilityCrowd delta({ 500, 500, size, 90.0f, reqMoveDist, notifyDelay, true });
+
+        for (uint32 step = 0; step < 200; ++step)
+        {
+            full.Update(0.05f, [](uint32) {});
+            delta.Update(0.05f, [](uint32) {});
+        }
+
+        for (uint32 i = 0; i < 500; ++i)
+            EXPECT_EQ(full.GetObjects()[i]->ClientObjects, delta.GetObjects()[i]->ClientObjects);
+
+        EXPECT_EQ(full.GetUpdates(), delta.GetUpdates());
+        Warhead::Benchmark::Compare(name, std::chrono::duration_cast<Microseconds>(full.GetUpdateTime()),
+            std::chrono::duration_cast<Microseconds>(delta.GetUpdateTime()), full.GetUpdates());
+        fmt::print("[ BENCH    ] {:<48} {:>10} full {:>10} delta\n", fmt::format("{} checks", name), full.GetChecks(), delta.GetChecks());
+    }
+}
+
+TEST(VisibilityDeltaBenchmark, DISABLED_CrowdLowLoad)
+{
+    // VisibilitySettings level 0, every player sees most of the crowd
+    Compare("Visibility 500 players in 300 yd, level 0", 300.0f, 1.0f, 0.3f);
+}
+
+TEST(VisibilityDeltaBenchmark, DISABLED_CrowdHighLoad)
+{
+    // VisibilitySettings level 6
+    Compare("Visibility 500 players in 300 yd, level 6", 300.0f, 5.0f, 1.2f);
+}
+
+TEST(VisibilityDeltaBenchmark, DISABLED_SpreadCrowd)
+{
+    Compare("Visibility 500 players in 1000 yd, level 0", 1000.0f, 1.0f, 0.3f);
+}
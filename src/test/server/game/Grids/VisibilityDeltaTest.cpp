@@ -0,0 +1,154 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "VisibilityCrowd.h"
+#include "VisibilityDelta.h"
+#include "gtest/gtest.h"
+
+TEST(VisibilityDeltaTest, CellChanges)
+{
+    // cell CENTER_GRID_CELL_ID starts at 0, the one before ends there
+    CellCoord const before(CENTER_GRID_CELL_ID - 1, CENTER_GRID_CELL_ID);
+    CellCoord const after(CENTER_GRID_CELL_ID, CENTER_GRID_CELL_ID);
+    CellCoord const far(CENTER_GRID_CELL_ID + 3, CENTER_GRID_CELL_ID);
+
+    VisibilityDelta const standing(Position(-30.0f, 30.0f, 0.0f), Position(-30.0f, 30.0f, 0.0f), 10.0f);
+    EXPECT_EQ(standing.GetCellChange(before), VisibilityDelta::CELL_KEPT);
+    EXPECT_EQ(standing.GetCellChange(after), VisibilityDelta::CELL_OUTSIDE);
+
+    VisibilityDelta const crossing(Position(-30.0f, 30.0f, 0.0f), Position(30.0f, 30.0f, 0.0f), 10.0f);
+    EXPECT_EQ(crossing.GetCellChange(before), VisibilityDelta::CELL_LEFT);
+    EXPECT_EQ(crossing.GetCellChange(after), VisibilityDelta::CELL_ENTERED);
+    EXPECT_EQ(crossing.GetCellChange(far), VisibilityDelta::CELL_OUTSIDE);
+    EXPECT_EQ(crossing.GetArea().low_bound.x_coord, before.x_coord);
+    EXPECT_EQ(crossing.GetArea().high_bound.x_coord, after.x_coord);
+}
+
+TEST(VisibilityDeltaTest, MayChange)
+{
+    // moved 2 yards, the margin is 2 + drift + slack
+    VisibilityDelta const delta(Position(0.0f, 0.0f, 0.0f), Position(2.0f, 0.0f, 0.0f), 120.0f);
+
+    EXPECT_FALSE(delta.MayChange(Position(50.0f, 0.0f, 0.0f), 90.0f, 0.0f));
+    EXPECT_FALSE(delta.MayChange(Position(0.0f, 200.0f, 0.0f), 90.0f, 0.0f));
+    EXPECT_TRUE(delta.MayChange(Position(89.0f, 0.0f, 0.0f), 90.0f, 0.0f));
+    EXPECT_TRUE(delta.MayChange(Position(-91.0f, 0.0f, 0.0f), 90.0f, 0.0f));
+    EXPECT_FALSE(delta.MayChange(Position(95.0f, 0.0f, 0.0f), 90.0f, 0.0f));
+
+    // a moving object near the range is checked
+    EXPECT_TRUE(delta.MayChange(Position(0.0f, 82.0f, 0.0f), 90.0f, 5.0f));
+    EXPECT_FALSE(delta.MayChange(Position(0.0f, 82.0f, 0.0f), 90.0f, 0.0f));
+
+    // the height counts
+    EXPECT_TRUE(delta.MayChange(Position(0.0f, 0.0f, 89.0f), 90.0f, 0.0f));
+}
+
+TEST(VisibilityDeltaTest, NeedsCheck)
+{
+    VisibilityDelta const delta(Position(0.0f, 0.0f, 0.0f), Position(2.0f, 0.0f, 0.0f), 120.0f);
+
+    // kept inside: only checked when the client lacks it, e.g. stealth ended since
+    EXPECT_FALSE(delta.NeedsCheck(Position(50.0f, 0.0f, 0.0f), 90.0f, 0.0f, true));
+    EXPECT_TRUE(delta.NeedsCheck(Position(50.0f, 0.0f, 0.0f), 90.0f, 0.0f, false));
+
+    // kept outside: only checked when the client still has it, e.g. it was teleported away
+    EXPECT_FALSE(delta.NeedsCheck(Position(0.0f, 200.0f, 0.0f), 90.0f, 0.0f, false));
+    EXPECT_TRUE(delta.NeedsCheck(Position(0.0f, 200.0f, 0.0f), 90.0f, 0.0f, true));
+
+    // near the range always
+    EXPECT_TRUE(delta.NeedsCheck(Position(89.0f, 0.0f, 0.0f), 90.0f, 0.0f, true));
+    EXPECT_TRUE(delta.NeedsCheck(Position(89.0f, 0.0f, 0.0f), 90.0f, 0.0f, false));
+
+    EXPECT_TRUE(VisibilityDelta::CoversClient(3, 3));
+    EXPECT_FALSE(VisibilityDelta::CoversClient(2, 3));
+}
+
+namespace
+{
+    // Every player update must leave the player seeing exactly what a full update shows, and every
+    // other player seeing the player exactly when a full update would. 'disturb' runs before every step.
+    template<typename Disturb>
+    VisibilityCrowd CheckCrowd(float reqMoveDist, float notifyDelay, Disturb&& disturb)
+    {
+        VisibilityCrowd crowd({ 150, 150, 300.0f, 90.0f, reqMoveDist, notifyDelay, true });
+        auto const& objects = crowd.GetObjects();
+        uint32 mismatches = 0;
+
+        for (uint32 step = 0; step < 200; ++step)
+        {
+            disturb(crowd, step);
+
+            crowd.Update(0.05f, [&](uint32 player)
+            {
+                for (uint32 i = 0; i < objects.size(); ++i)
+                {
+                    if (i == player)
+                        continue;
+
+                    mismatches += objects[player]->ClientObjects.contains(i) != crowd.IsVisible(*objects[player], *objects[i]);
+
+                    if (objects[i]->IsPlayer)
+                        mismatches += objects[i]->ClientObjects.contains(player) != crowd.IsVisible(*objects[i], *objects[player]);
+                }
+            });
+        }
+
+        EXPECT_GT(crowd.GetUpdates(), 0u);
+        EXPECT_EQ(mismatches, 0u);
+        return crowd;
+    }
+
+    void CheckCrowd(float reqMoveDist, float notifyDelay)
+    {
+        CheckCrowd(reqMoveDist, notifyDelay, [](VisibilityCrowd&, uint32) { });
+    }
+}
+
+TEST(VisibilityDeltaTest, CrowdMatchesFullUpdate)
+{
+    // lowest and highest load level of VisibilitySettings
+    CheckCrowd(1.0f, 0.3f);
+    CheckCrowd(5.0f, 1.2f);
+}
+
+TEST(VisibilityDeltaTest, StealthStartsAndEnds)
+{
+    // creatures 150 and up, a few of them go in and out of stealth at a time
+    CheckCrowd(1.0f, 0.3f, [](VisibilityCrowd& crowd, uint32 step)
+    {
+        for (uint32 i = 150; i + 7 <= 300; i += 7)
+            crowd.SetStealthed(i + step % 7, step % 40 < 20);
+    });
+}
+
+TEST(VisibilityDeltaTest, ObjectsLeaveView)
+{
+    VisibilityCrowd const crowd = CheckCrowd(1.0f, 0.3f, [](VisibilityCrowd& crowd, uint32 step)
+    {
+        if (step % 10)
+            return;
+
+        // one creature far away, out of every visited cell, one across the square
+        uint32 const creature = 150 + step / 10 * 2;
+        crowd.Teleport(creature, Position(2000.0f, 2000.0f, 0.0f));
+        crowd.Teleport(creature + 1, Position(step % 20 ? 0.0f : 300.0f, 150.0f, 0.0f));
+    });
+
+    // the far ones are only dropped by the full update
+    EXPECT_GT(crowd.GetFallbacks(), 0u);
+}
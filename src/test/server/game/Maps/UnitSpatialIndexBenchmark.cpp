@@ -0,0 +1,168 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Benchmark.h"
+#include "UnitSpatialIndex.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Stand-in for a unit seen by a searcher. A Unit is several kilobytes and the fields a check
+    // reads are spread over it, so every unit the grid walk looks at costs a few cache misses.
+    struct Object
+    {
+        virtual ~Object() = default;
+        [[nodiscard]] virtual bool IsAlive() const { return true; }
+        [[nodiscard]] virtual bool IsHostile() const { return Hostile; }
+
+        uint32 PhaseMask{ 1 };
+        std::array<uint8, 1024> Data1{};
+        float X{};
+        float Y{};
+        std::array<uint8, 1024> Data2{};
+        float Reach{};
+        std::array<uint8, 1024> Data3{};
+        bool Hostile{};
+    };
+
+    struct AoECheck
+    {
+        float X, Y, Range;
+
+        // like a unit searcher with AnyUnfriendlyUnitInObjectRangeCheck: phase, alive, distance including combat reach, faction
+        bool operator()(Object const* object) const
+        {
+            if (!(object->PhaseMask & 1) || !object->IsAlive())
+                return false;
+
+            float const dx = object->X - X;
+            float const dy = object->Y - Y;
+            float const range = Range + object->Reach;
+            return dx * dx + dy * dy <= range * range && object->IsHostile();
+        }
+    };
+
+    // Units of a dense city (Dalaran) spread over a 150 x 150 yards square
+    struct City
+    {
+        std::vector<std::unique_ptr<Object>> Objects;
+        std::unordered_map<uint32, std::vector<Object*>> Cells;
+        SpatialCellIndex<Object*> Index;
+        std::vector<std::pair<float, float>> Queries;
+
+        explicit City(uint32 units)
+        {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> coord(5700.0f, 5850.0f);
+
+            for (uint32 i = 0; i < units; ++i)
+            {
+                auto& object = Objects.emplace_back(std::make_unique<Object>());
+                object->X = coord(rng);
+                object->Y = coord(rng);
+                object->Reach = 1.5f;
+                object->Hostile = rng() % 4 == 0;
+
+                Cells[SpatialCellIndex<Object*>::GetCellId(object->X, object->Y)].push_back(object.get());
+                Index.Insert(object.get(), object->X, object->Y, object->Reach);
+            }
+
+            for (uint32 i = 0; i < 2000; ++i)
+                Queries.emplace_back(coord(rng), coord(rng));
+        }
+
+        // the grid walk: every unit of every cell touched by the search area goes through the check
+        uint64 SearchGrid(float range) const
+        {
+            uint64 found = 0;
+
+            for (auto const& [x, y] : Queries)
+            {
+                AoECheck const check{ x, y, range };
+                // the searched area includes the combat reach of the units, as the index does
+                float const area = range + 1.5f;
+                CellCoord const low = Warhead::ComputeCellCoord(x - area, y - area);
+                CellCoord const high = Warhead::ComputeCellCoord(x + area, y + area);
+
+                for (uint32 cellX = low.x_coord; cellX <= high.x_coord; ++cellX)
+                {
+                    for (uint32 cellY = low.y_coord; cellY <= high.y_coord; ++cellY)
+                    {
+                        auto itr = Cells.find(CellCoord(cellX, cellY).GetId());
+                        if (itr == Cells.end())
+                            continue;
+
+                        for (Object const* object : itr->second)
+                            found += check(object);
+                    }
+                }
+            }
+
+            return found;
+        }
+
+        uint64 SearchIndex(float range) const
+        {
+            uint64 found = 0;
+
+            for (auto const& [x, y] : Queries)
+            {
+                AoECheck const check{ x, y, range };
+                Index.Visit(x, y, range, [&](Object* object)
+                {
+                    found += check(object);
+                    return true;
+                });
+            }
+
+            return found;
+        }
+    };
+
+    void Compare(char const* name, uint32 units, float range)
+    {
+        City const city(units);
+        uint64 gridFound = 0, indexFound = 0;
+
+        auto const grid = Warhead::Benchmark::Measure(5, [&]() { gridFound = city.SearchGrid(range); });
+        auto const index = Warhead::Benchmark::Measure(5, [&]() { indexFound = city.SearchIndex(range); });
+
+        EXPECT_EQ(gridFound, indexFound);
+        Warhead::Benchmark::Compare(name, grid, index, city.Queries.size());
+    }
+}
+
+TEST(UnitSpatialIndexBenchmark, DISABLED_DenseCityMelee)
+{
+    Compare("UnitSpatialIndex 1500 units, 5 yd searches", 1500, 5.0f);
+}
+
+TEST(UnitSpatialIndexBenchmark, DISABLED_DenseCityAoE)
+{
+    Compare("UnitSpatialIndex 1500 units, 30 yd searches", 1500, 30.0f);
+}
+
+TEST(UnitSpatialIndexBenchmark, DISABLED_SparseArea)
+{
+    Compare("UnitSpatialIndex 100 units, 30 yd searches", 100, 30.0f);
+}
@@ -106,6 +106,8 @@ bool StartDB()
     sDatabaseMgr->AddDatabase(WorldDatabase, "World");
     sDatabaseMgr->AddDatabase(DBCDatabase, "Dbc");
 
+    sDatabaseMgr->SetImportThreads(sConfigMgr->GetOption<uint32>("FastImport.Threads", 4));
+
     if (!sDatabaseMgr->Load())
         return false;
 
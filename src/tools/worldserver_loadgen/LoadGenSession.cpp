@@ -0,0 +1,612 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "LoadGenSession.h"
+#include "CryptoHash.h"
+#include "CryptoRandom.h"
+#include "LoadGenStats.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include "SharedDefines.h"
+#include "StringFormat.h"
+#include <boost/asio/post.hpp>
+#include <boost/asio/write.hpp>
+#include <cmath>
+
+// Client build sent in CMSG_AUTH_SESSION, 3.3.5a
+#define LOADGEN_CLIENT_BUILD 12340
+// Radius in yards of the circle the simulated characters walk around their login position
+#define LOADGEN_MOVE_RADIUS 3.0f
+// Number of heartbeats it takes to walk the circle once
+#define LOADGEN_MOVE_STEPS 8
+
+namespace
+{
+    /// Character names may only contain letters, the account index is written in base 26
+    std::string MakeCharacterName(std::string const& prefix, uint32 index)
+    {
+        std::string suffix;
+        do
+        {
+            suffix.insert(suffix.begin(), char('a' + index % 26));
+            index /= 26;
+        } while (index);
+
+        return prefix + suffix;
+    }
+}
+
+LoadGenSession::LoadGenSession(boost::asio::io_context& ioContext, tcp::endpoint const& endpoint, LoadGenAccount const& account,
+    LoadGenScenario const& scenario, bool tickProbe) :
+    _socket(ioContext), _endpoint(endpoint), _account(account), _scenario(scenario), _tickProbe(tickProbe), _header(), _headerSize(4),
+    _headerReceived(0), _opcode(0), _inWorld(false), _closed(false), _writing(false), _actionTimer(ioContext), _pingTimer(ioContext),
+    _tickProbeTimer(ioContext), _guid(0), _mapId(0), _homeX(0.0f), _homeY(0.0f), _homeZ(0.0f), _orientation(0.0f), _moveStep(0),
+    _pingCounter(0), _castCount(0), _startTime(std::chrono::steady_clock::now()), _random(account.Index)
+{
+    _packetBuffer.Resize(0);
+}
+
+void LoadGenSession::Start()
+{
+    _socket.async_connect(_endpoint, std::bind(&LoadGenSession::OnConnect, shared_from_this(), std::placeholders::_1));
+}
+
+void LoadGenSession::Stop()
+{
+    boost::asio::post(_socket.get_executor(), std::bind(&LoadGenSession::Close, shared_from_this()));
+}
+
+void LoadGenSession::OnConnect(boost::system::error_code const& error)
+{
+    if (_closed)
+        return;
+
+    if (error)
+    {
+        Fail(Warhead::StringFormat("connect failed: {}", error.message()));
+        return;
+    }
+
+    sLoadGenStats->AddConnected();
+
+    boost::system::error_code ignored;
+    _socket.set_option(tcp::no_delay(true), ignored);
+
+    AsyncRead();
+}
+
+void LoadGenSession::AsyncRead()
+{
+    _readBuffer.Normalize();
+    _readBuffer.EnsureFreeSpace();
+    _socket.async_read_some(boost::asio::buffer(_readBuffer.GetWritePointer(), _readBuffer.GetRemainingSpace()),
+        std::bind(&LoadGenSession::OnRead, shared_from_this(), std::placeholders::_1, std::placeholders::_2));
+}
+
+void LoadGenSession::OnRead(boost::system::error_code const& error, std::size_t transferredBytes)
+{
+    if (_closed)
+        return;
+
+    if (error)
+    {
+        LOG_DEBUG("loadgen", "Session {} disconnected: {}", _account.Name, error.message());
+        sLoadGenStats->AddDisconnected();
+        Close();
+        return;
+    }
+
+    _readBuffer.WriteCompleted(transferredBytes);
+
+    if (!ReadPackets())
+        return;
+
+    AsyncRead();
+}
+
+bool LoadGenSession::ReadPackets()
+{
+    while (_readBuffer.GetActiveSize() > 0 && !_closed)
+    {
+        if (_headerReceived < _headerSize)
+        {
+            // decrypted byte by byte, the first one tells whether the header has a 3 byte size
+            while (_headerReceived < _headerSize && _readBuffer.GetActiveSize() > 0)
+            {
+                uint8 byte = *_readBuffer.GetReadPointer();
+                _readBuffer.ReadCompleted(1);
+
+                if (_authCrypt.IsInitialized())
+                    _authCrypt.DecryptRecv(&byte, 1);
+
+                if (!_headerReceived && (byte & 0x80))
+                    _headerSize = 5;
+
+                _header[_headerReceived++] = byte;
+            }
+
+            if (_headerReceived < _headerSize)
+                break;
+
+            uint32 size;
+            if (_headerSize == 5)
+            {
+                size = (uint32(_header[0] & 0x7F) << 16) | (uint32(_header[1]) << 8) | _header[2];
+                _opcode = _header[3] | (uint16(_header[4]) << 8);
+            }
+            else
+            {
+                size = (uint32(_header[0]) << 8) | _header[1];
+                _opcode = _header[2] | (uint16(_header[3]) << 8);
+            }
+
+            if (size < sizeof(_opcode))
+            {
+                Fail(Warhead::StringFormat("received malformed header (size: {}, opcode: {})", size, _opcode));
+                return false;
+            }
+
+            _packetBuffer.Reset();
+            _packetBuffer.Resize(size - sizeof(_opcode));
+        }
+
+        std::size_t payloadBytes = std::min(_packetBuffer.GetRemainingSpace(), _readBuffer.GetActiveSize());
+        _packetBuffer.Write(_readBuffer.GetReadPointer(), payloadBytes);
+        _readBuffer.ReadCompleted(payloadBytes);
+
+        if (_packetBuffer.GetRemainingSpace() > 0)
+            break;
+
+        sLoadGenStats->AddReceived(_headerSize + _packetBuffer.GetActiveSize());
+
+        WorldPacket packet(_opcode, std::move(_packetBuffer));
+        _headerReceived = 0;
+        _headerSize = 4;
+
+        try
+        {
+            HandlePacket(packet);
+        }
+        catch (ByteBufferException const&)
+        {
+            Fail(Warhead::StringFormat("received malformed packet 0x{:03X}", packet.GetOpcode()));
+            return false;
+        }
+    }
+
+    return !_closed;
+}
+
+void LoadGenSession::HandlePacket(WorldPacket& packet)
+{
+    switch (packet.GetOpcode())
+    {
+        case SMSG_AUTH_CHALLENGE:
+            HandleAuthChallenge(packet);
+            break;
+        case SMSG_AUTH_RESPONSE:
+            HandleAuthResponse(packet);
+            break;
+        case SMSG_CHAR_ENUM:
+            CompleteResponse(CMSG_CHAR_ENUM);
+            HandleCharEnum(packet);
+            break;
+        case SMSG_CHAR_CREATE:
+            CompleteResponse(CMSG_CHAR_CREATE);
+            HandleCharCreate(packet);
+            break;
+        case SMSG_LOGIN_VERIFY_WORLD:
+            CompleteResponse(CMSG_PLAYER_LOGIN);
+            HandleLoginVerifyWorld(packet);
+            break;
+        case SMSG_TIME_SYNC_REQ:
+            HandleTimeSyncRequest(packet);
+            break;
+        case SMSG_PONG:
+            CompleteResponse(CMSG_PING);
+            break;
+        case SMSG_MESSAGECHAT:
+            HandleMessageChat(packet);
+            break;
+        case SMSG_CAST_FAILED:
+            CompleteResponse(CMSG_CAST_SPELL);
+            break;
+        case SMSG_SPELL_START:
+        {
+            // spell starts are broadcast, only our own casts answer our requests
+            uint64 casterItem, caster;
+            packet.readPackGUID(casterItem);
+            packet.readPackGUID(caster);
+
+            if (caster == _guid)
+                CompleteResponse(CMSG_CAST_SPELL);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void LoadGenSession::HandleAuthChallenge(WorldPacket& packet)
+{
+    std::array<uint8, 4> authSeed;
+    packet.read_skip<uint32>();
+    packet.read(authSeed);
+
+    std::array<uint8, 4> localChallenge;
+    Warhead::Crypto::GetRandomBytes(localChallenge);
+
+    uint8 t[4] = { 0x00, 0x00, 0x00, 0x00 };
+
+    Warhead::Crypto::SHA1 sha;
+    sha.UpdateData(_account.Name);
+    sha.UpdateData(t, sizeof(t));
+    sha.UpdateData(localChallenge);
+    sha.UpdateData(authSeed);
+    sha.UpdateData(_account.Key);
+    sha.Finalize();
+
+    WorldPacket authSession(CMSG_AUTH_SESSION, 64 + _account.Name.size());
+    authSession << uint32(LOADGEN_CLIENT_BUILD);
+    authSession << uint32(0);                               // LoginServerID
+    authSession << _account.Name;
+    authSession << uint32(0);                               // LoginServerType
+    authSession.append(localChallenge);
+    authSession << uint32(0);                               // RegionID
+    authSession << uint32(0);                               // BattlegroupID
+    authSession << uint32(_scenario.RealmId);
+    authSession << uint64(0);                               // DosResponse
+    authSession.append(sha.GetDigest());
+    authSession << uint32(0);                               // uncompressed size of the (empty) addon info
+
+    SendPacket(authSession);
+    ExpectResponse(CMSG_AUTH_SESSION);
+
+    // the server encrypts every header from its response on
+    _authCrypt.InitClient(_account.Key);
+}
+
+void LoadGenSession::HandleAuthResponse(WorldPacket& packet)
+{
+    uint8 code;
+    packet >> code;
+
+    switch (code)
+    {
+        case AUTH_OK:
+        {
+            CompleteResponse(CMSG_AUTH_SESSION);
+
+            WorldPacket charEnum(CMSG_CHAR_ENUM, 0);
+            SendPacket(charEnum);
+            ExpectResponse(CMSG_CHAR_ENUM);
+            break;
+        }
+        case AUTH_WAIT_QUEUE:
+            LOG_DEBUG("loadgen", "Session {} is waiting in the login queue", _account.Name);
+            break;
+        default:
+            Fail(Warhead::StringFormat("authentication rejected with code {}", code));
+            break;
+    }
+}
+
+void LoadGenSession::HandleCharEnum(WorldPacket& packet)
+{
+    uint8 count;
+    packet >> count;
+
+    if (count)
+    {
+        packet >> _guid;
+
+        WorldPacket playerLogin(CMSG_PLAYER_LOGIN, 8);
+        playerLogin << _guid;
+        SendPacket(playerLogin);
+        ExpectResponse(CMSG_PLAYER_LOGIN);
+        return;
+    }
+
+    WorldPacket charCreate(CMSG_CHAR_CREATE, 32);
+    charCreate << MakeCharacterName(_scenario.CharacterNamePrefix, _account.Index);
+    charCreate << uint8(RACE_HUMAN) << uint8(CLASS_WARRIOR) << uint8(GENDER_MALE);
+    charCreate << uint8(0) << uint8(0) << uint8(0) << uint8(0) << uint8(0); // skin, face, hair style, hair color, facial hair
+    charCreate << uint8(0);                                 // outfit id
+    SendPacket(charCreate);
+    ExpectResponse(CMSG_CHAR_CREATE);
+}
+
+void LoadGenSession::HandleCharCreate(WorldPacket& packet)
+{
+    uint8 code;
+    packet >> code;
+
+    if (code != CHAR_CREATE_SUCCESS)
+    {
+        Fail(Warhead::StringFormat("character creation failed with code {}", code));
+        return;
+    }
+
+    WorldPacket charEnum(CMSG_CHAR_ENUM, 0);
+    SendPacket(charEnum);
+    ExpectResponse(CMSG_CHAR_ENUM);
+}
+
+void LoadGenSession::HandleLoginVerifyWorld(WorldPacket& packet)
+{
+    packet >> _mapId >> _homeX >> _homeY >> _homeZ >> _orientation;
+
+    if (_inWorld)
+        return;
+
+    _inWorld = true;
+    sLoadGenStats->AddInWorld();
+
+    ScheduleAction();
+    SchedulePing();
+
+    if (_tickProbe)
+        ScheduleTickProbe();
+}
+
+void LoadGenSession::HandleTimeSyncRequest(WorldPacket& packet)
+{
+    uint32 counter;
+    packet >> counter;
+
+    WorldPacket timeSync(CMSG_TIME_SYNC_RESP, 8);
+    timeSync << counter;
+    timeSync << uint32(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - _startTime).count());
+    SendPacket(timeSync);
+}
+
+void LoadGenSession::HandleMessageChat(WorldPacket& packet)
+{
+    uint8 type;
+    int32 language;
+    uint64 sender;
+    packet >> type >> language >> sender;
+
+    if (type == CHAT_MSG_SAY && sender == _guid)
+    {
+        CompleteResponse(CMSG_MESSAGECHAT);
+        return;
+    }
+
+    if (type != CHAT_MSG_SYSTEM || !_tickProbe)
+        return;
+
+    // answer of .server info: "Update time diff: {}ms, Average: {}ms"
+    std::string_view text(reinterpret_cast<char const*>(packet.contents()), packet.size());
+    std::size_t pos = text.find("Update time diff: ");
+    if (pos == std::string_view::npos)
+        return;
+
+    char const* diff = text.data() + pos + 18;
+    char* end = nullptr;
+    uint32 lastDiff = uint32(std::strtoul(diff, &end, 10));
+
+    std::size_t averagePos = text.find("Average: ", end - text.data());
+    if (averagePos == std::string_view::npos)
+        return;
+
+    uint32 averageDiff = uint32(std::strtoul(text.data() + averagePos + 9, nullptr, 10));
+    sLoadGenStats->AddTickTime(lastDiff, averageDiff);
+}
+
+void LoadGenSession::SendPacket(WorldPacket const& packet)
+{
+    // client header: 2 byte big endian size including the opcode, 4 byte opcode
+    std::vector<uint8> data(6 + packet.size());
+    uint16 size = uint16(packet.size() + 4);
+    uint32 opcode = packet.GetOpcode();
+    data[0] = uint8(size >> 8);
+    data[1] = uint8(size);
+    data[2] = uint8(opcode);
+    data[3] = uint8(opcode >> 8);
+    data[4] = uint8(opcode >> 16);
+    data[5] = uint8(opcode >> 24);
+
+    if (_authCrypt.IsInitialized())
+        _authCrypt.EncryptSend(data.data(), 6);
+
+    if (!packet.empty())
+        std::memcpy(data.data() + 6, packet.contents(), packet.size());
+
+    sLoadGenStats->AddSent(data.size());
+
+    _writeQueue.push_back(std::move(data));
+
+    if (!_writing)
+        AsyncWrite();
+}
+
+void LoadGenSession::AsyncWrite()
+{
+    _writing = true;
+    boost::asio::async_write(_socket, boost::asio::buffer(_writeQueue.front()),
+        std::bind(&LoadGenSession::OnWrite, shared_from_this(), std::placeholders::_1, std::placeholders::_2));
+}
+
+void LoadGenSession::OnWrite(boost::system::error_code const& error, std::size_t /*transferredBytes*/)
+{
+    _writing = false;
+
+    if (_closed)
+        return;
+
+    if (error)
+    {
+        LOG_DEBUG("loadgen", "Session {} disconnected: {}", _account.Name, error.message());
+        sLoadGenStats->AddDisconnected();
+        Close();
+        return;
+    }
+
+    _writeQueue.pop_front();
+
+    if (!_writeQueue.empty())
+        AsyncWrite();
+}
+
+void LoadGenSession::ScheduleAction()
+{
+    // spread the actions so the sessions do not send in lockstep
+    std::uniform_int_distribution<int64> jitter(_scenario.ActionInterval.count() / 2, _scenario.ActionInterval.count() * 3 / 2);
+
+    _actionTimer.expires_from_now(boost::posix_time::milliseconds(jitter(_random)));
+    _actionTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_closed)
+            return;
+
+        self->DoAction();
+        self->ScheduleAction();
+    });
+}
+
+void LoadGenSession::DoAction()
+{
+    uint32 totalWeight = _scenario.MoveWeight + _scenario.ChatWeight + _scenario.SpellWeight;
+    if (!totalWeight)
+        return;
+
+    uint32 roll = std::uniform_int_distribution<uint32>(0, totalWeight - 1)(_random);
+
+    if (roll < _scenario.MoveWeight)
+        SendMove();
+    else if (roll < _scenario.MoveWeight + _scenario.ChatWeight)
+    {
+        SendChat(_scenario.ChatText);
+        ExpectResponse(CMSG_MESSAGECHAT);
+    }
+    else
+        SendCastSpell();
+}
+
+void LoadGenSession::SendMove()
+{
+    _moveStep = (_moveStep + 1) % LOADGEN_MOVE_STEPS;
+
+    float angle = 2.0f * float(M_PI) * _moveStep / LOADGEN_MOVE_STEPS;
+
+    WorldPacket move(MSG_MOVE_HEARTBEAT, 40);
+    move.appendPackGUID(_guid);
+    move << uint32(0);                                      // movement flags
+    move << uint16(0);                                      // extra movement flags
+    move << uint32(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - _startTime).count());
+    move << float(_homeX + LOADGEN_MOVE_RADIUS * std::cos(angle));
+    move << float(_homeY + LOADGEN_MOVE_RADIUS * std::sin(angle));
+    move << float(_homeZ);
+    move << float(std::fmod(angle + float(M_PI) / 2.0f, 2.0f * float(M_PI)));
+    move << uint32(0);                                      // fall time
+    SendPacket(move);
+}
+
+void LoadGenSession::SendChat(std::string const& text)
+{
+    WorldPacket chat(CMSG_MESSAGECHAT, 9 + text.size());
+    chat << uint32(CHAT_MSG_SAY);
+    chat << uint32(LANG_COMMON);
+    chat << text;
+    SendPacket(chat);
+}
+
+void LoadGenSession::SendCastSpell()
+{
+    WorldPacket cast(CMSG_CAST_SPELL, 10);
+    cast << uint8(++_castCount);
+    cast << uint32(_scenario.SpellId);
+    cast << uint8(0);                                       // cast flags
+    cast << uint32(0);                                      // target mask, self
+    SendPacket(cast);
+    ExpectResponse(CMSG_CAST_SPELL);
+}
+
+void LoadGenSession::SchedulePing()
+{
+    _pingTimer.expires_from_now(boost::posix_time::milliseconds(_scenario.PingInterval.count()));
+    _pingTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_closed)
+            return;
+
+        WorldPacket ping(CMSG_PING, 8);
+        ping << uint32(++self->_pingCounter);
+        ping << uint32(0);                                  // latency
+        self->SendPacket(ping);
+        self->ExpectResponse(CMSG_PING);
+
+        self->SchedulePing();
+    });
+}
+
+void LoadGenSession::ScheduleTickProbe()
+{
+    _tickProbeTimer.expires_from_now(boost::posix_time::milliseconds(_scenario.TickProbeInterval.count()));
+    _tickProbeTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_closed)
+            return;
+
+        // commands are not echoed, so no response is expected
+        self->SendChat(".server info");
+        self->ScheduleTickProbe();
+    });
+}
+
+void LoadGenSession::ExpectResponse(uint16 requestOpcode)
+{
+    _pendingRequests[requestOpcode].push_back(std::chrono::steady_clock::now());
+}
+
+void LoadGenSession::CompleteResponse(uint16 requestOpcode)
+{
+    auto itr = _pendingRequests.find(requestOpcode);
+    if (itr == _pendingRequests.end() || itr->second.empty())
+        return;
+
+    sLoadGenStats->AddLatency(requestOpcode, std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - itr->second.front()));
+    itr->second.pop_front();
+}
+
+void LoadGenSession::Fail(std::string_view reason)
+{
+    if (_closed)
+        return;
+
+    LOG_ERROR("loadgen", "Session {} failed: {}", _account.Name, reason);
+    sLoadGenStats->AddFailed();
+    Close();
+}
+
+void LoadGenSession::Close()
+{
+    if (_closed)
+        return;
+
+    _closed = true;
+
+    _actionTimer.cancel();
+    _pingTimer.cancel();
+    _tickProbeTimer.cancel();
+
+    boost::system::error_code ignored;
+    _socket.shutdown(tcp::socket::shutdown_both, ignored);
+    _socket.close(ignored);
+}
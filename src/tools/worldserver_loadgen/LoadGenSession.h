@@ -0,0 +1,138 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _LOADGEN_SESSION_H_
+#define _LOADGEN_SESSION_H_
+
+#include "AuthCrypt.h"
+#include "DeadlineTimer.h"
+#include "Duration.h"
+#include "MessageBuffer.h"
+#include "WorldPacket.h"
+#include <boost/asio/ip/tcp.hpp>
+#include <deque>
+#include <random>
+#include <unordered_map>
+
+using boost::asio::ip::tcp;
+
+struct LoadGenAccount
+{
+    uint32 Index;
+    std::string Name;
+    SessionKey Key;
+};
+
+/// Scripted behaviour shared by all simulated sessions, read from the configuration file
+struct LoadGenScenario
+{
+    uint32 RealmId;
+    std::string CharacterNamePrefix;
+    Milliseconds ActionInterval;
+    uint32 MoveWeight;
+    uint32 ChatWeight;
+    uint32 SpellWeight;
+    uint32 SpellId;
+    std::string ChatText;
+    Milliseconds PingInterval;
+    Milliseconds TickProbeInterval;
+};
+
+/// One simulated 3.3.5a client: authenticates, enters the world with its first character and then runs the scenario
+class LoadGenSession : public std::enable_shared_from_this<LoadGenSession>
+{
+public:
+    LoadGenSession(boost::asio::io_context& ioContext, tcp::endpoint const& endpoint, LoadGenAccount const& account,
+        LoadGenScenario const& scenario, bool tickProbe);
+
+    void Start();
+
+    /// Thread safe, closes the connection from the session's own io_context
+    void Stop();
+
+private:
+    void OnConnect(boost::system::error_code const& error);
+    void AsyncRead();
+    void OnRead(boost::system::error_code const& error, std::size_t transferredBytes);
+    bool ReadPackets();
+
+    void HandlePacket(WorldPacket& packet);
+    void HandleAuthChallenge(WorldPacket& packet);
+    void HandleAuthResponse(WorldPacket& packet);
+    void HandleCharEnum(WorldPacket& packet);
+    void HandleCharCreate(WorldPacket& packet);
+    void HandleLoginVerifyWorld(WorldPacket& packet);
+    void HandleTimeSyncRequest(WorldPacket& packet);
+    void HandleMessageChat(WorldPacket& packet);
+
+    void SendPacket(WorldPacket const& packet);
+    void AsyncWrite();
+    void OnWrite(boost::system::error_code const& error, std::size_t transferredBytes);
+
+    void ScheduleAction();
+    void DoAction();
+    void SendMove();
+    void SendChat(std::string const& text);
+    void SendCastSpell();
+    void SchedulePing();
+    void ScheduleTickProbe();
+
+    /// Remembers when a request was sent, its response completes the oldest pending one
+    void ExpectResponse(uint16 requestOpcode);
+    void CompleteResponse(uint16 requestOpcode);
+
+    void Fail(std::string_view reason);
+    void Close();
+
+    tcp::socket _socket;
+    tcp::endpoint _endpoint;
+    LoadGenAccount const& _account;
+    LoadGenScenario const& _scenario;
+    bool _tickProbe;
+
+    AuthCrypt _authCrypt;
+    MessageBuffer _readBuffer;
+    MessageBuffer _packetBuffer;
+    std::array<uint8, 5> _header;
+    std::size_t _headerSize;
+    std::size_t _headerReceived;
+    uint16 _opcode;
+    bool _inWorld;
+    bool _closed;
+
+    std::deque<std::vector<uint8>> _writeQueue;
+    bool _writing;
+
+    Warhead::Asio::DeadlineTimer _actionTimer;
+    Warhead::Asio::DeadlineTimer _pingTimer;
+    Warhead::Asio::DeadlineTimer _tickProbeTimer;
+
+    uint64 _guid;
+    uint32 _mapId;
+    float _homeX, _homeY, _homeZ;
+    float _orientation;
+    uint32 _moveStep;
+    uint32 _pingCounter;
+    uint8 _castCount;
+    TimePoint _startTime;
+    std::mt19937 _random;
+
+    std::unordered_map<uint16, std::deque<TimePoint>> _pendingRequests;
+};
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "LoadGenStats.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include <algorithm>
+
+namespace
+{
+    std::string GetOpcodeName(uint16 opcode)
+    {
+        switch (opcode)
+        {
+            case CMSG_AUTH_SESSION: return "CMSG_AUTH_SESSION";
+            case CMSG_CHAR_ENUM: return "CMSG_CHAR_ENUM";
+            case CMSG_CHAR_CREATE: return "CMSG_CHAR_CREATE";
+            case CMSG_PLAYER_LOGIN: return "CMSG_PLAYER_LOGIN";
+            case CMSG_PING: return "CMSG_PING";
+            case CMSG_MESSAGECHAT: return "CMSG_MESSAGECHAT";
+            case CMSG_CAST_SPELL: return "CMSG_CAST_SPELL";
+            default: return Warhead::StringFormat("0x{:03X}", opcode);
+        }
+    }
+
+    std::string FormatBound(uint32 bound)
+    {
+        return bound ? Warhead::StringFormat("{:.2f}ms", bound / 1000.0f) : std::string(">1s");
+    }
+}
+
+void LoadGenLatencyHistogram::Add(uint64 latency)
+{
+    ++Buckets[std::lower_bound(LoadGenLatencyBuckets.begin(), LoadGenLatencyBuckets.end(), latency) - LoadGenLatencyBuckets.begin()];
+    ++Count;
+    Sum += latency;
+    Max = std::max(Max, latency);
+}
+
+uint32 LoadGenLatencyHistogram::GetPercentileBound(float percentile) const
+{
+    uint64 rank = uint64(Count * percentile);
+    uint64 seen = 0;
+
+    for (std::size_t i = 0; i < LoadGenLatencyBuckets.size(); ++i)
+    {
+        seen += Buckets[i];
+        if (seen > rank)
+            return LoadGenLatencyBuckets[i];
+    }
+
+    return 0;
+}
+
+LoadGenStats* LoadGenStats::instance()
+{
+    static LoadGenStats instance;
+    return &instance;
+}
+
+void LoadGenStats::AddSent(std::size_t bytes)
+{
+    _sentPackets.fetch_add(1, std::memory_order_relaxed);
+    _sentBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void LoadGenStats::AddReceived(std::size_t bytes)
+{
+    _receivedPackets.fetch_add(1, std::memory_order_relaxed);
+    _receivedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void LoadGenStats::AddLatency(uint16 requestOpcode, Microseconds latency)
+{
+    std::lock_guard<std::mutex> lock(_latencyLock);
+    _latency[requestOpcode].Add(std::max<int64>(latency.count(), 0));
+}
+
+void LoadGenStats::AddTickTime(uint32 lastDiff, uint32 averageDiff)
+{
+    std::lock_guard<std::mutex> lock(_tickLock);
+    ++_tickSamples;
+    _lastTickDiff = lastDiff;
+    _lastTickAverage = averageDiff;
+    _maxTickDiff = std::max(_maxTickDiff, lastDiff);
+}
+
+void LoadGenStats::Report(Seconds interval, bool final)
+{
+    uint64 sentPackets = _sentPackets.load(std::memory_order_relaxed);
+    uint64 sentBytes = _sentBytes.load(std::memory_order_relaxed);
+    uint64 receivedPackets = _receivedPackets.load(std::memory_order_relaxed);
+    uint64 receivedBytes = _receivedBytes.load(std::memory_order_relaxed);
+    float seconds = std::max<float>(interval.count(), 1.0f);
+
+    LOG_INFO("loadgen", "{} report, sessions: {} connected, {} in world, {} failed, {} disconnected",
+        final ? "Final" : "Interval", _connected.load(), _inWorld.load(), _failed.load(), _disconnected.load());
+
+    // the final report covers the whole run, interval reports only the time since the previous one
+    uint64 sentPacketsBase = final ? 0 : _reportedSentPackets;
+    uint64 sentBytesBase = final ? 0 : _reportedSentBytes;
+    uint64 receivedPacketsBase = final ? 0 : _reportedReceivedPackets;
+    uint64 receivedBytesBase = final ? 0 : _reportedReceivedBytes;
+
+    LOG_INFO("loadgen", "  Sent {:.1f} packets/s ({:.1f} KiB/s), received {:.1f} packets/s ({:.1f} KiB/s)",
+        (sentPackets - sentPacketsBase) / seconds, (sentBytes - sentBytesBase) / 1024.0f / seconds,
+        (receivedPackets - receivedPacketsBase) / seconds, (receivedBytes - receivedBytesBase) / 1024.0f / seconds);
+
+    _reportedSentPackets = sentPackets;
+    _reportedSentBytes = sentBytes;
+    _reportedReceivedPackets = receivedPackets;
+    _reportedReceivedBytes = receivedBytes;
+
+    {
+        std::lock_guard<std::mutex> lock(_latencyLock);
+        for (auto const& [opcode, histogram] : _latency)
+        {
+            if (!histogram.Count)
+                continue;
+
+            LOG_INFO("loadgen", "  {:<20} {:>9} requests, avg {:.2f}ms, p50 <= {}, p95 <= {}, p99 <= {}, max {:.2f}ms",
+                GetOpcodeName(opcode), histogram.Count, histogram.Sum / 1000.0f / histogram.Count,
+                FormatBound(histogram.GetPercentileBound(0.50f)), FormatBound(histogram.GetPercentileBound(0.95f)),
+                FormatBound(histogram.GetPercentileBound(0.99f)), histogram.Max / 1000.0f);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_tickLock);
+    if (_tickSamples)
+        LOG_INFO("loadgen", "  World update time: last {}ms, average {}ms, max seen {}ms ({} samples)",
+            _lastTickDiff, _lastTickAverage, _maxTickDiff, _tickSamples);
+}
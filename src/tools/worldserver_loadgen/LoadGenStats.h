@@ -0,0 +1,96 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _LOADGEN_STATS_H_
+#define _LOADGEN_STATS_H_
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+
+/// Upper bounds in microseconds of the latency histogram buckets, the last bucket counts everything above
+constexpr std::array<uint32, 12> LoadGenLatencyBuckets = { 250, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000, 1000000 };
+
+struct LoadGenLatencyHistogram
+{
+    std::array<uint64, LoadGenLatencyBuckets.size() + 1> Buckets = { };
+    uint64 Count = 0;
+    uint64 Sum = 0;
+    uint64 Max = 0;
+
+    void Add(uint64 latency);
+
+    /// Upper bound of the bucket holding the given percentile, 0 when it is in the open ended bucket
+    uint32 GetPercentileBound(float percentile) const;
+};
+
+class LoadGenStats
+{
+public:
+    static LoadGenStats* instance();
+
+    void AddSent(std::size_t bytes);
+    void AddReceived(std::size_t bytes);
+
+    /// Round trip of a request, from sending requestOpcode until its response arrived
+    void AddLatency(uint16 requestOpcode, Microseconds latency);
+
+    /// World update time reported by the worldserver itself
+    void AddTickTime(uint32 lastDiff, uint32 averageDiff);
+
+    void AddConnected() { ++_connected; }
+    void AddInWorld() { ++_inWorld; }
+    void AddFailed() { ++_failed; }
+    void AddDisconnected() { ++_disconnected; }
+
+    /// Logs rates over interval and the latency distribution since the start, the final report's interval is the whole run
+    void Report(Seconds interval, bool final);
+
+private:
+    LoadGenStats() = default;
+
+    std::atomic<uint64> _sentPackets{ 0 };
+    std::atomic<uint64> _sentBytes{ 0 };
+    std::atomic<uint64> _receivedPackets{ 0 };
+    std::atomic<uint64> _receivedBytes{ 0 };
+    uint64 _reportedSentPackets{ 0 };
+    uint64 _reportedSentBytes{ 0 };
+    uint64 _reportedReceivedPackets{ 0 };
+    uint64 _reportedReceivedBytes{ 0 };
+
+    std::atomic<uint32> _connected{ 0 };
+    std::atomic<uint32> _inWorld{ 0 };
+    std::atomic<uint32> _failed{ 0 };
+    std::atomic<uint32> _disconnected{ 0 };
+
+    std::mutex _latencyLock;
+    std::map<uint16, LoadGenLatencyHistogram> _latency;
+
+    std::mutex _tickLock;
+    uint32 _tickSamples{ 0 };
+    uint32 _lastTickDiff{ 0 };
+    uint32 _lastTickAverage{ 0 };
+    uint32 _maxTickDiff{ 0 };
+};
+
+#define sLoadGenStats LoadGenStats::instance()
+
+#endif
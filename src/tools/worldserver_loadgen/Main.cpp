@@ -0,0 +1,303 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Common.h"
+#include "Config.h"
+#include "CryptoRandom.h"
+#include "DatabaseEnv.h"
+#include "DatabaseMgr.h"
+#include "IoContext.h"
+#include "LoadGenSession.h"
+#include "LoadGenStats.h"
+#include "Log.h"
+#include "Logo.h"
+#include "OpenSSLCrypto.h"
+#include "SRP6.h"
+#include "Util.h"
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/program_options.hpp>
+#include <boost/version.hpp>
+#include <csignal>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+#ifndef _WARHEAD_LOADGEN_CONFIG
+#define _WARHEAD_LOADGEN_CONFIG "worldserver_loadgen.conf"
+#endif
+
+using namespace boost::program_options;
+namespace fs = std::filesystem;
+
+namespace
+{
+    std::atomic<bool> StopRequested(false);
+
+    void SignalHandler(int /*signal*/)
+    {
+        StopRequested = true;
+    }
+}
+
+bool StartDB();
+void StopDB();
+bool PrepareAccounts(std::vector<LoadGenAccount>& accounts);
+LoadGenScenario LoadScenario();
+variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile);
+
+/// Launch the load generator
+int main(int argc, char** argv)
+{
+    signal(SIGABRT, &Warhead::AbortHandler);
+
+    // Command line parsing
+    auto configFile = fs::path(sConfigMgr->GetConfigPath() + std::string(_WARHEAD_LOADGEN_CONFIG));
+    auto vm = GetConsoleArguments(argc, argv, configFile);
+
+    // exit if help or version is enabled
+    if (vm.count("help"))
+        return 0;
+
+    // Add file and args in config
+    sConfigMgr->Configure(configFile.generic_string(), std::vector<std::string>(argv, argv + argc));
+
+    if (!sConfigMgr->LoadAppConfigs())
+        return 1;
+
+    std::vector<std::string> overriddenKeys = sConfigMgr->OverrideWithEnvVariablesIfAny();
+
+    // Init logging
+    sLog->Initialize();
+
+    Warhead::Logo::Show("worldserver_loadgen",
+        [](std::string_view text)
+        {
+            LOG_INFO("loadgen", text);
+        },
+        []()
+        {
+            LOG_INFO("loadgen", "> Using configuration file:       {}", sConfigMgr->GetFilename());
+            LOG_INFO("loadgen", "> Using logs directory:           {}", sLog->GetLogsDir());
+            LOG_INFO("loadgen", "> Using Boost version:            {}.{}.{}", BOOST_VERSION / 100000, BOOST_VERSION / 100 % 1000, BOOST_VERSION % 100);
+        }
+    );
+
+    for (std::string const& key : overriddenKeys)
+        LOG_INFO("loadgen", "Configuration field {} was overridden with environment variable.", key);
+
+    OpenSSLCrypto::threadsSetup();
+
+    std::shared_ptr<void> opensslHandle(nullptr, [](void*) { OpenSSLCrypto::threadsCleanup(); });
+
+    // Initialize the database connection, it is only needed to prepare the accounts
+    if (!StartDB())
+        return 1;
+
+    std::vector<LoadGenAccount> accounts;
+    bool accountsReady = PrepareAccounts(accounts);
+    StopDB();
+
+    if (!accountsReady)
+        return 1;
+
+    boost::system::error_code error;
+    boost::asio::ip::address address = boost::asio::ip::make_address(sConfigMgr->GetOption<std::string>("LoadGen.Address", "127.0.0.1"), error);
+    if (error)
+    {
+        LOG_ERROR("loadgen", "Invalid LoadGen.Address: {}", error.message());
+        return 1;
+    }
+
+    tcp::endpoint endpoint(address, sConfigMgr->GetOption<uint16>("LoadGen.Port", 8085));
+    LoadGenScenario const scenario = LoadScenario();
+
+    uint32 threadCount = std::max<uint32>(sConfigMgr->GetOption<uint32>("LoadGen.Threads", 4), 1);
+    uint32 connectRate = std::max<uint32>(sConfigMgr->GetOption<uint32>("LoadGen.ConnectRate", 100), 1);
+    Seconds duration = Seconds(sConfigMgr->GetOption<uint32>("LoadGen.Duration", 300));
+    Seconds reportInterval = Seconds(std::max<uint32>(sConfigMgr->GetOption<uint32>("LoadGen.ReportInterval", 10), 1));
+
+    std::vector<std::unique_ptr<Warhead::Asio::IoContext>> ioContexts;
+    std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> workGuards;
+    std::vector<std::thread> threads;
+
+    for (uint32 i = 0; i < threadCount; ++i)
+    {
+        ioContexts.push_back(std::make_unique<Warhead::Asio::IoContext>(1));
+        workGuards.emplace_back(ioContexts.back()->get_executor());
+    }
+
+    for (auto& ioContext : ioContexts)
+        threads.emplace_back([&ioContext]() { ioContext->run(); });
+
+    std::vector<std::shared_ptr<LoadGenSession>> sessions;
+    sessions.reserve(accounts.size());
+
+    // the first session also reports the world update time of the server
+    for (LoadGenAccount const& account : accounts)
+        sessions.push_back(std::make_shared<LoadGenSession>(*ioContexts[sessions.size() % threadCount], endpoint, account, scenario, sessions.empty()));
+
+    signal(SIGINT, &SignalHandler);
+    signal(SIGTERM, &SignalHandler);
+
+    LOG_INFO("loadgen", "Starting {} sessions against {}:{} at {} sessions/s with {} threads", sessions.size(), address.to_string(), endpoint.port(),
+        connectRate, threadCount);
+
+    TimePoint start = std::chrono::steady_clock::now();
+    TimePoint lastReport = start;
+    std::size_t startedSessions = 0;
+
+    while (!StopRequested)
+    {
+        TimePoint now = std::chrono::steady_clock::now();
+        if (duration.count() && now - start >= duration)
+            break;
+
+        // ramp up, so the login of all sessions does not hit the server at once
+        std::size_t dueSessions = std::min<std::size_t>(sessions.size(), (std::chrono::duration_cast<Milliseconds>(now - start).count() * connectRate) / 1000 + 1);
+        for (; startedSessions < dueSessions; ++startedSessions)
+            sessions[startedSessions]->Start();
+
+        if (now - lastReport >= reportInterval)
+        {
+            sLoadGenStats->Report(std::chrono::duration_cast<Seconds>(now - lastReport), false);
+            lastReport = now;
+        }
+
+        std::this_thread::sleep_for(100ms);
+    }
+
+    LOG_INFO("loadgen", "Stopping sessions...");
+
+    for (std::shared_ptr<LoadGenSession> const& session : sessions)
+        session->Stop();
+
+    workGuards.clear();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    sLoadGenStats->Report(std::chrono::duration_cast<Seconds>(std::chrono::steady_clock::now() - start), true);
+
+    LOG_INFO("loadgen", "Halting process...");
+
+    return 0;
+}
+
+/// Initialize connection to the database
+bool StartDB()
+{
+    sDatabaseMgr->AddDatabase(AuthDatabase, "Auth");
+
+    if (!sDatabaseMgr->Load())
+        return false;
+
+    LOG_INFO("loadgen", "Started database connection pool.");
+    return true;
+}
+
+/// Close the connection to the database
+void StopDB()
+{
+    sDatabaseMgr->CloseAllConnections();
+}
+
+/// Creates missing accounts and stores a fresh session key for each, like a successful login on the authserver does
+bool PrepareAccounts(std::vector<LoadGenAccount>& accounts)
+{
+    uint32 count = sConfigMgr->GetOption<uint32>("LoadGen.Sessions", 100);
+    std::string prefix = sConfigMgr->GetOption<std::string>("LoadGen.AccountPrefix", "LOADGEN");
+    bool createAccounts = sConfigMgr->GetOption<bool>("LoadGen.CreateAccounts", true);
+
+    std::transform(prefix.begin(), prefix.end(), prefix.begin(), ::toupper);
+
+    accounts.reserve(count);
+
+    for (uint32 i = 1; i <= count; ++i)
+    {
+        LoadGenAccount& account = accounts.emplace_back();
+        account.Index = i;
+        account.Name = prefix + std::to_string(i);
+
+        AuthDatabasePreparedStatement stmt = AuthDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_ID_BY_NAME);
+        stmt->SetData(0, account.Name);
+
+        if (!AuthDatabase.Query(stmt))
+        {
+            if (!createAccounts)
+            {
+                LOG_ERROR("loadgen", "Account {} does not exist and LoadGen.CreateAccounts is disabled", account.Name);
+                return false;
+            }
+
+            // the password is the account name, so the accounts can be used with a real client as well
+            auto [salt, verifier] = Warhead::Crypto::SRP6::MakeRegistrationData(account.Name, account.Name);
+            AuthDatabase.DirectExecute("INSERT INTO account (username, salt, verifier, expansion, joindate) VALUES ('{}', 0x{}, 0x{}, 2, NOW())",
+                account.Name, ByteArrayToHexStr(salt), ByteArrayToHexStr(verifier));
+        }
+
+        Warhead::Crypto::GetRandomBytes(account.Key);
+
+        stmt = AuthDatabase.GetPreparedStatement(LOGIN_UPD_LOGONPROOF);
+        stmt->SetArguments(account.Key, "127.0.0.1", uint8(LOCALE_enUS), "", account.Name);
+        AuthDatabase.DirectExecute(stmt);
+    }
+
+    LOG_INFO("loadgen", "Prepared {} accounts with prefix {}", count, prefix);
+    return true;
+}
+
+LoadGenScenario LoadScenario()
+{
+    LoadGenScenario scenario;
+    scenario.RealmId = sConfigMgr->GetOption<uint32>("LoadGen.RealmID", 1);
+    scenario.CharacterNamePrefix = sConfigMgr->GetOption<std::string>("LoadGen.CharacterPrefix", "Loadgen");
+    scenario.ActionInterval = Milliseconds(std::max<uint32>(sConfigMgr->GetOption<uint32>("LoadGen.ActionInterval", 500), 1));
+    scenario.MoveWeight = sConfigMgr->GetOption<uint32>("LoadGen.Weight.Move", 70);
+    scenario.ChatWeight = sConfigMgr->GetOption<uint32>("LoadGen.Weight.Chat", 10);
+    scenario.SpellWeight = sConfigMgr->GetOption<uint32>("LoadGen.Weight.Spell", 20);
+    scenario.SpellId = sConfigMgr->GetOption<uint32>("LoadGen.SpellId", 6673);
+    scenario.ChatText = sConfigMgr->GetOption<std::string>("LoadGen.ChatText", "Load test");
+    scenario.PingInterval = Milliseconds(std::max<uint32>(sConfigMgr->GetOption<uint32>("LoadGen.PingInterval", 30000), 1000));
+    scenario.TickProbeInterval = Milliseconds(std::max<uint32>(sConfigMgr->GetOption<uint32>("LoadGen.TickProbeInterval", 5000), 1000));
+    return scenario;
+}
+
+variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile)
+{
+    options_description all("Allowed options");
+    all.add_options()
+        ("help,h", "print usage message")
+        ("config,c", value<fs::path>(&configFile)->default_value(fs::path(sConfigMgr->GetConfigPath() + std::string(_WARHEAD_LOADGEN_CONFIG))), "use <arg> as configuration file");
+
+    variables_map variablesMap;
+
+    try
+    {
+        store(command_line_parser(argc, argv).options(all).allow_unregistered().run(), variablesMap);
+        notify(variablesMap);
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << e.what() << "\n";
+    }
+
+    if (variablesMap.count("help"))
+        std::cout << all << "\n";
+
+    return variablesMap;
+}